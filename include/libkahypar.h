@@ -22,6 +22,7 @@
 #define LIBKAHYPAR_H
 
 #include <stddef.h>
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -49,10 +50,19 @@ struct kahypar_context_s;
 typedef struct kahypar_context_s kahypar_context_t;
 typedef struct kahypar_hypergraph_s kahypar_hypergraph_t;
 
+/* Libraries built with KAHYPAR_USE_64_BIT_IDS use 64-bit IDs and weights.
+ * In this case, client code has to be compiled with -DKAHYPAR_USE_64_BIT_IDS as well. */
+#ifdef KAHYPAR_USE_64_BIT_IDS
+typedef uint64_t kahypar_hypernode_id_t;
+typedef uint64_t kahypar_hyperedge_id_t;
+typedef int64_t kahypar_hypernode_weight_t;
+typedef int64_t kahypar_hyperedge_weight_t;
+#else
 typedef unsigned int kahypar_hypernode_id_t;
 typedef unsigned int kahypar_hyperedge_id_t;
 typedef int kahypar_hypernode_weight_t;
 typedef int kahypar_hyperedge_weight_t;
+#endif
 typedef int kahypar_partition_id_t;
 
 KAHYPAR_API kahypar_context_t* kahypar_context_new();
@@ -76,6 +76,11 @@ po::options_description createGeneralOptionsDescription(Context& context, const
     ("part-file",
     po::value<std::string>(&context.partition.input_partition_filename)->value_name("<string>"),
     "Input Partition filename. The input partition is then refined using direct k-way V-cycles.")
+    ("coarsening-cache",
+    po::value<std::string>(&context.partition.coarsening_cache_filename)->value_name("<string>"),
+    "Coarsening cache filename. Direct k-way partitioning replays the contractions stored in the "
+    "file if it was created for the same hypergraph and coarsening parameters (k and epsilon may "
+    "differ) and (re)creates the file otherwise.")
     ("cmaxnet",
     po::value<HyperedgeID>(&context.partition.hyperedge_size_threshold)->value_name("<uint32_t>"),
     "Hyperedges larger than cmaxnet are ignored during partitioning process.")
@@ -208,6 +213,7 @@ po::options_description createCoarseningOptionsDescription(Context& context,
     }),
     "Coarsening Algorithm:\n"
     " - ml_style\n"
+    " - parallel_ml_style\n"
     " - heavy_full\n"
     " - heavy_lazy")
     ((initial_partitioning ? "i-c-s" : "c-s"),
@@ -217,6 +223,12 @@ po::options_description createCoarseningOptionsDescription(Context& context,
     ((initial_partitioning ? "i-c-t" : "c-t"),
     po::value<HypernodeID>((initial_partitioning ? &context.initial_partitioning.coarsening.contraction_limit_multiplier : &context.coarsening.contraction_limit_multiplier))->value_name("<int>"),
     "Coarsening stops when there are no more than t * k hypernodes left")
+    ((initial_partitioning ? "i-c-min-shrink-factor" : "c-min-shrink-factor"),
+    po::value<double>((initial_partitioning ? &context.initial_partitioning.coarsening.min_shrink_factor : &context.coarsening.min_shrink_factor))->value_name("<double>"),
+    "If an ml_style pass shrinks the number of hypernodes by less than this factor,\n"
+    "hypernodes that could not be matched are clustered around a common neighbor\n"
+    "of high degree (two-hop matching). Isolated hypernodes are clustered with each other.\n"
+    "(default: 0 = disabled)")
     ((initial_partitioning ? "i-c-rating-score" : "c-rating-score"),
     po::value<std::string>()->value_name("<string>")->notifier(
       [&context, initial_partitioning](const std::string& rating_score) {
@@ -603,7 +615,31 @@ po::options_description createGenericOptionsDescription(Context& context,
     ("sp-process,s", po::value<bool>(&context.partition.sp_process_output)->value_name("<bool>"),
     "Summarize partitioning results in RESULT line compatible with sqlplottools "
     "(https://github.com/bingmann/sqlplottools)")
-    ("write-partition,w", po::value<bool>(&context.partition.write_partition_file)->value_name("<bool>"), "Write output partition. Default: false");
+    ("write-partition,w", po::value<bool>(&context.partition.write_partition_file)->value_name("<bool>"), "Write output partition. Default: false")
+    ("input-format",
+    po::value<std::string>()->value_name("<string>")->notifier(
+      [&](const std::string& format) {
+      context.partition.input_format = kahypar::inputFormatFromString(format);
+    }),
+    "Format of the hypergraph file:\n"
+    " - auto   : detect by header and file extension (.mtx, .patoh, .u)\n"
+    " - hmetis\n"
+    " - binary\n"
+    " - mtx    : MatrixMarket coordinate format\n"
+    " - patoh\n"
+    "(default: auto)")
+    ("matrix-model",
+    po::value<std::string>()->value_name("<string>")->notifier(
+      [&](const std::string& model) {
+      context.partition.matrix_model = kahypar::matrixModelFromString(model);
+    }),
+    "Hypergraph model for MatrixMarket files:\n"
+    " - row_net    : rows are hyperedges, columns are hypernodes\n"
+    " - column_net : columns are hyperedges, rows are hypernodes\n"
+    " - fine_grain : nonzeros are hypernodes, rows and columns are hyperedges\n"
+    "(default: row_net)")
+    ("binary-partition", po::value<bool>(&context.partition.write_binary_partition_file)->value_name("<bool>"),
+    "Write output partition in binary format (int32 block IDs after a header) instead of one block ID per line. Default: false");
   return generic_options;
 }
 
@@ -615,7 +651,7 @@ void processCommandLineInput(Context& context, int argc, char* argv[]) {
   required_options.add_options()
     ("hypergraph,h",
     po::value<std::string>(&context.partition.graph_filename)->value_name("<string>")->required(),
-    "Hypergraph filename")
+    "Hypergraph filename (hMETIS, KaHyPar binary, MatrixMarket or PaToH format)")
     ("blocks,k",
     po::value<PartitionID>(&context.partition.k)->value_name("<int>")->required()->notifier(
       [&](const PartitionID) {
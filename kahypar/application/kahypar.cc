@@ -25,7 +25,9 @@
 #include "kahypar/partitioner_facade.h"
 
 #include "kahypar/utils/signal_handling.h"
+#include "kahypar/utils/timer.h"
 
+#include <chrono>
 #include <csignal>
 #include <functional>
 
@@ -39,9 +41,18 @@ int main(int argc, char* argv[]) {
 
   kahypar::processCommandLineInput(context, argc, argv);
 
+  const kahypar::HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+  // Communities stored in a binary hypergraph file are reused instead of being detected again.
   kahypar::Hypergraph hypergraph(
     kahypar::io::createHypergraphFromFile(context.partition.graph_filename,
-                                          context.partition.k));
+                                          context.partition.k,
+                                          context.partition.input_format,
+                                          context.partition.matrix_model,
+                                          &context.partition.input_stats,
+                                          &context.evolutionary.communities));
+  const kahypar::HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+  kahypar::Timer::instance().add(context, kahypar::Timepoint::read_hypergraph,
+                                 std::chrono::duration<double>(end - start).count());
 
   kahypar::SerializeOnSignal::initialize(hypergraph, context);
 
@@ -81,6 +81,11 @@ class BinaryHeapBase {
     return _next_slot - 1;
   }
 
+  // ! Number of bytes allocated for the heap and the handles
+  size_t memoryConsumption() const {
+    return _max_size * (sizeof(HeapElement) + sizeof(size_t));
+  }
+
   bool empty() const {
     return size() == 0;
   }
@@ -86,6 +86,17 @@ class EnhancedBucketQueue {
     return _num_elements;
   }
 
+  // ! Number of bytes allocated by the queue (excluding the nodes of the std::set index)
+  size_t memoryConsumption() const {
+    size_t size = _contains.size() * sizeof(RepositoryElement) +
+                  _contains.memoryConsumption() + _valid.memoryConsumption() +
+                  _valid.size() * sizeof(std::vector<IDType>);
+    for (size_t i = 0; i < _valid.size(); ++i) {
+      size += _buckets[i].capacity() * sizeof(IDType);
+    }
+    return size;
+  }
+
   bool empty() const {
     return _num_elements == 0;
   }
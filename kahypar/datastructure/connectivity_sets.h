@@ -26,81 +26,71 @@
 #include <utility>
 #include <vector>
 
+#include "kahypar/datastructure/pin_count_in_part.h"
 #include "kahypar/macros.h"
 #include "kahypar/meta/mandatory.h"
 
 namespace kahypar {
 namespace ds {
+/*!
+ * Stores the connectivity set Λ(e), i.e. the blocks connected by e, for each hyperedge e.
+ *
+ * All connectivity sets are stored in a single arena: hyperedge e owns a contiguous range of
+ * min(k, |e|) entries, of which the first |Λ(e)| contain the connected blocks in insertion
+ * order. Additionally, the position of each block within this range is stored in a
+ * bit-packed |E| x k index (0 = not contained), such that contains(), add() and remove()
+ * take constant time. Removing a block swaps the last block into its position.
+ */
 template <typename PartitionID = Mandatory,
           typename HyperedgeID = Mandatory>
 class ConnectivitySets final {
  private:
-  using Byte = char;
+  // Stores position + 1 of each block in the arena range of a hyperedge.
+  using PositionIndex = PinCountInPart<PartitionID, HyperedgeID, PartitionID>;
 
  public:
-  // Internal structure for connectivity sets.
-  // Each contains the size of the connectivity set as  the header
-  // and afterwards the _dense and sparse arrays and the partition pin counts.
-  // This memory is allocated outside the structure using a memory arena.
+  // Lightweight view on the connectivity set of a single hyperedge.
+  // It is invalidated if the connectivity set is modified.
   class ConnectivitySet {
  public:
-    explicit ConnectivitySet() :
-      _contained_parts() { }
+    ConnectivitySet(const ConnectivitySets& sets, const HyperedgeID he) :
+      _sets(sets),
+      _he(he) { }
 
-    ConnectivitySet(const ConnectivitySet&) = delete;
+    ConnectivitySet(const ConnectivitySet&) = default;
     ConnectivitySet& operator= (const ConnectivitySet&) = delete;
 
     ConnectivitySet(ConnectivitySet&&) = default;
-    ConnectivitySet& operator= (ConnectivitySets&) = delete;
+    ConnectivitySet& operator= (ConnectivitySet&&) = delete;
 
     ~ConnectivitySet() = default;
 
     const PartitionID* begin()  const {
-      return _contained_parts.data();
+      return _sets._arena.data() + _sets._offsets[_he];
     }
 
     const PartitionID* end() const {
-      return _contained_parts.data() + _contained_parts.size();
+      return begin() + _sets._sizes[_he];
     }
 
     bool contains(const PartitionID value) const {
-      return std::find(_contained_parts.begin(), _contained_parts.end(), value) != _contained_parts.end();
-    }
-
-    void add(const PartitionID value) {
-      ASSERT(std::find(_contained_parts.begin(), _contained_parts.end(), value) == _contained_parts.end());
-      _contained_parts.push_back(value);
-    }
-
-    void remove(const PartitionID value) {
-      ASSERT(std::find(_contained_parts.begin(), _contained_parts.end(), value) != _contained_parts.end());
-      auto it = std::find(_contained_parts.begin(), _contained_parts.end(), value);
-
-      if (it != _contained_parts.end()) {
-        std::swap(*it, _contained_parts.back());
-      }
-      _contained_parts.pop_back();
-    }
-
-    void clear() {
-      _contained_parts.clear();
+      return _sets.contains(_he, value);
     }
 
     PartitionID size() const {
-      return _contained_parts.size();
+      return _sets._sizes[_he];
     }
 
  private:
-    std::vector<PartitionID> _contained_parts;
+    const ConnectivitySets& _sets;
+    const HyperedgeID _he;
   };
 
-
-  explicit ConnectivitySets(const HyperedgeID num_hyperedges) :
-    _connectivity_sets(num_hyperedges) { }
-
   ConnectivitySets() :
-    _connectivity_sets() { }
-
+    _offsets(),
+    _sizes(),
+    _arena(),
+    _positions() { }
 
   ~ConnectivitySets() = default;
 
@@ -111,26 +101,75 @@ class ConnectivitySets final {
 
   ConnectivitySets& operator= (ConnectivitySets&& other) = default;
 
-  void initialize(const HyperedgeID num_hyperedges) {
-    _connectivity_sets.resize(num_hyperedges);
+  /*!
+   * Allocates empty connectivity sets.
+   *
+   * \param num_hyperedges Number of hyperedges
+   * \param k Number of blocks
+   * \param max_size Functor returning an upper bound on the size of each hyperedge
+   */
+  template <typename MaxSize>
+  void initialize(const HyperedgeID num_hyperedges, const PartitionID k, const MaxSize& max_size) {
+    _offsets.resize(static_cast<size_t>(num_hyperedges) + 1);
+    _sizes.assign(num_hyperedges, 0);
+    PartitionID max_capacity = 0;
+    size_t offset = 0;
+    for (HyperedgeID he = 0; he < num_hyperedges; ++he) {
+      _offsets[he] = offset;
+      const PartitionID capacity = static_cast<PartitionID>(
+        std::min(static_cast<size_t>(k), static_cast<size_t>(max_size(he))));
+      max_capacity = std::max(max_capacity, capacity);
+      offset += capacity;
+    }
+    _offsets[num_hyperedges] = offset;
+    _arena.assign(offset, 0);
+    _positions.initialize(num_hyperedges, k, max_capacity);
   }
 
-  void resize(const HyperedgeID num_hyperedges) {
-    _connectivity_sets.clear();
-    initialize(num_hyperedges);
+  bool contains(const HyperedgeID he, const PartitionID value) const {
+    return _positions.get(he, value) != 0;
+  }
+
+  void add(const HyperedgeID he, const PartitionID value) {
+    ASSERT(!contains(he, value), V(he) << V(value));
+    ASSERT(_offsets[he] + _sizes[he] < _offsets[he + 1], "Connectivity set of" << he << "is full");
+    _arena[_offsets[he] + _sizes[he]] = value;
+    ++_sizes[he];
+    _positions.set(he, value, _sizes[he]);
+  }
+
+  void remove(const HyperedgeID he, const PartitionID value) {
+    ASSERT(contains(he, value), V(he) << V(value));
+    const PartitionID position = _positions.get(he, value) - 1;
+    const PartitionID last = _arena[_offsets[he] + _sizes[he] - 1];
+    _arena[_offsets[he] + position] = last;
+    _positions.set(he, last, position + 1);
+    _positions.set(he, value, 0);
+    --_sizes[he];
+  }
+
+  void clear(const HyperedgeID he) {
+    for (PartitionID i = 0; i < _sizes[he]; ++i) {
+      _positions.set(he, _arena[_offsets[he] + i], 0);
+    }
+    _sizes[he] = 0;
   }
 
-  const ConnectivitySet& operator[] (const HyperedgeID he) const {
-    return _connectivity_sets[he];
+  ConnectivitySet operator[] (const HyperedgeID he) const {
+    return ConnectivitySet(*this, he);
   }
 
-  // To avoid code duplication we implement non-const version in terms of const version
-  ConnectivitySet& operator[] (const HyperedgeID he) {
-    return const_cast<ConnectivitySet&>(static_cast<const ConnectivitySets&>(*this).operator[] (he));
+  // ! Number of bytes allocated for the arena and the position index
+  size_t memoryConsumption() const {
+    return _offsets.capacity() * sizeof(size_t) + _sizes.capacity() * sizeof(PartitionID) +
+           _arena.capacity() * sizeof(PartitionID) + _positions.memoryConsumption();
   }
 
  private:
-  std::vector<ConnectivitySet> _connectivity_sets;
+  std::vector<size_t> _offsets;
+  std::vector<PartitionID> _sizes;
+  std::vector<PartitionID> _arena;
+  PositionIndex _positions;
 };
 }  // namespace ds
 }  // namespace kahypar
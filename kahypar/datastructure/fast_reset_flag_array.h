@@ -87,6 +87,14 @@ class FastResetFlagArray {
     memset(_v.get(), (initialiser ? 1 : 0), size * sizeof(UnderlyingType));
   }
 
+  size_t size() const {
+    return _size;
+  }
+
+  size_t memoryConsumption() const {
+    return _size * sizeof(UnderlyingType);
+  }
+
  private:
   bool isSet(size_t i) const {
     return _v[i] == _threshold;
@@ -21,11 +21,13 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <bitset>
 #include <cstring>
 #include <iostream>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <tuple>
 #include <unordered_map>
@@ -36,6 +38,8 @@
 
 #include "kahypar/datastructure/connectivity_sets.h"
 #include "kahypar/datastructure/fast_reset_flag_array.h"
+#include "kahypar/datastructure/incident_net_storage.h"
+#include "kahypar/datastructure/pin_count_in_part.h"
 #include "kahypar/datastructure/sparse_set.h"
 #include "kahypar/macros.h"
 #include "kahypar/meta/empty.h"
@@ -43,6 +47,7 @@
 #include "kahypar/meta/mandatory.h"
 #include "kahypar/partition/context_enum_classes.h"
 #include "kahypar/utils/math.h"
+#include "kahypar/utils/memory_tree.h"
 
 
 namespace kahypar {
@@ -80,6 +85,8 @@ Iterator end(const std::pair<Iterator, Iterator>& x) {
  * \tparam PartitionIDType_ The data type used for block ids
  * \tparam HypernodeData_ Additional data that should be available for each hypernode
  * \tparam HyperedgeData_ Additional data that should be available for each hyperedge
+ * \tparam IncidentNetStorage_ Storage backend for the incident nets of all hypernodes
+ * (see incident_net_storage.h)
  *
  */
 template <typename HypernodeType_ = Mandatory,
@@ -88,7 +95,8 @@ template <typename HypernodeType_ = Mandatory,
           typename HyperedgeWeightType_ = Mandatory,
           typename PartitionIDType_ = Mandatory,
           class HypernodeData_ = meta::Empty,
-          class HyperedgeData_ = meta::Empty>
+          class HyperedgeData_ = meta::Empty,
+          class IncidentNetStorage_ = IncidentNetVectors<HypernodeType_, HyperedgeType_> >
 class GenericHypergraph {
  private:
   static constexpr bool debug = false;
@@ -102,6 +110,7 @@ class GenericHypergraph {
   using HyperedgeWeight = HyperedgeWeightType_;
   using HypernodeData = HypernodeData_;
   using HyperedgeData = HyperedgeData_;
+  using IncidentNetStorage = IncidentNetStorage_;
 
   // seed for edge hashes used for parallel net detection
   static constexpr size_t kEdgeHashSeed = 42;
@@ -153,6 +162,38 @@ class GenericHypergraph {
     }  // NOLINT
   };
 
+  // ! Synchronization state used by contractConcurrently()
+  struct ConcurrentContractionState {
+    explicit ConcurrentContractionState(const HyperedgeID num_hyperedges) :
+      hyperedge_locks(std::make_unique<std::atomic<bool>[]>(num_hyperedges)),
+      timestamp(0),
+      num_contractions(0),
+      num_removed_pins(0),
+      fixed_vertex_mutex(),
+      active(false) {
+      for (HyperedgeID he = 0; he < num_hyperedges; ++he) {
+        hyperedge_locks[he].store(false, std::memory_order_relaxed);
+      }
+    }
+
+    void lock(const HyperedgeID he) {
+      while (hyperedge_locks[he].exchange(true, std::memory_order_acquire)) {
+        while (hyperedge_locks[he].load(std::memory_order_relaxed)) { }
+      }
+    }
+
+    void unlock(const HyperedgeID he) {
+      hyperedge_locks[he].store(false, std::memory_order_release);
+    }
+
+    std::unique_ptr<std::atomic<bool>[]> hyperedge_locks;
+    std::atomic<size_t> timestamp;
+    std::atomic<HypernodeID> num_contractions;
+    std::atomic<HypernodeID> num_removed_pins;
+    std::mutex fixed_vertex_mutex;
+    bool active;
+  };
+
   // ! Constant to denote invalid partition pin counts.
   static constexpr HypernodeID kInvalidCount = std::numeric_limits<HypernodeID>::max();
 
@@ -167,11 +208,9 @@ class GenericHypergraph {
      * \param weight The weight of the hypernode/hyperedge
      */
     explicit Vertex(const WeightType weight) :
-      _incident_nets(),
       _weight(weight) { }
 
     Vertex() :
-      _incident_nets(),
       _weight(1) { }
 
     Vertex(const Vertex&) = default;
@@ -198,36 +237,18 @@ class GenericHypergraph {
       _valid = true;
     }
 
-    IDType size() const {
-      ASSERT(!isDisabled());
-      return _incident_nets.size();
-    }
-
     WeightType weight() const {
       ASSERT(!isDisabled());
       return _weight;
     }
 
-    std::vector<HyperedgeID> & incidentNets() {
-      return _incident_nets;
-    }
-
-    const std::vector<HyperedgeID> & incidentNets() const {
-      return _incident_nets;
-    }
-
     void setWeight(WeightType weight) {
       ASSERT(!isDisabled());
       _weight = weight;
     }
 
     bool operator== (const Vertex& rhs) const {
-      return _incident_nets.size() == rhs._incident_nets.size() &&
-             _weight == rhs._weight &&
-             _valid == rhs._valid &&
-             std::is_permutation(_incident_nets.begin(),
-                                 _incident_nets.end(),
-                                 rhs._incident_nets.begin());
+      return _weight == rhs._weight && _valid == rhs._valid;
     }
 
     bool operator!= (const Vertex& rhs) const {
@@ -235,7 +256,6 @@ class GenericHypergraph {
     }
 
  private:
-    std::vector<HyperedgeID> _incident_nets;
     // ! Hypernode/Hyperedge weight
     WeightType _weight = 1;
     // ! Flag indicating whether or not the element is active.
@@ -460,7 +480,7 @@ class GenericHypergraph {
 
 
   // ! The data type used to incident nets of vertices and pins of nets
-  using VertexID = uint32_t;
+  using VertexID = HypernodeID;
   // ! The data type for hypernodes
   using Hypernode = Vertex<HypernodeTraits, AdditionalHypernodeData>;
   // ! The data type for hyperedges
@@ -621,17 +641,25 @@ class GenericHypergraph {
     _threshold_marked(2),
     _hypernodes(_num_hypernodes, Hypernode(1)),
     _hyperedges(_num_hyperedges, Hyperedge(0, 0, 1)),
+    _incident_nets(),
     _incidence_array(_num_pins, 0),
     _communities(_num_hypernodes, 0),
     _fixed_vertices(nullptr),
     _fixed_vertex_part_id(),
     _part_info(_k),
-    _pins_in_part(static_cast<size_t>(_num_hyperedges) * k),
-    _connectivity_sets(_num_hyperedges),
-    _hes_not_containing_u(_num_hyperedges) {
+    _pins_in_part(),
+    _connectivity_sets(),
+    _hes_not_containing_u(_num_hyperedges),
+    _snapshot_part_id(),
+    _nodes_moved_since_snapshot(),
+    _partition_snapshot_active(false),
+    _concurrent_contractions(nullptr) {
     VertexID edge_vector_index = 0;
+    HypernodeID max_edge_size = 0;
     for (HyperedgeID i = 0; i < _num_hyperedges; ++i) {
       hyperedge(i).setFirstEntry(edge_vector_index);
+      max_edge_size = std::max(max_edge_size, static_cast<HypernodeID>(
+                                 index_vector[static_cast<size_t>(i) + 1] - index_vector[i]));
       for (VertexID pin_index = index_vector[i];
            pin_index < index_vector[static_cast<size_t>(i) + 1]; ++pin_index) {
         hyperedge(i).incrementSize();
@@ -641,13 +669,8 @@ class GenericHypergraph {
       }
     }
 
-    for (HyperedgeID i = 0; i < _num_hyperedges; ++i) {
-      for (VertexID pin_index = index_vector[i]; pin_index <
-           index_vector[static_cast<size_t>(i) + 1]; ++pin_index) {
-        const HypernodeID pin = edge_vector[pin_index];
-        hypernode(pin).incidentNets().push_back(i);
-      }
-    }
+    buildIncidentNets();
+    _pins_in_part.initialize(_num_hyperedges, _k, max_edge_size);
 
     // sentinel for peeks during uncontraction
     if (num_hyperedges == 0) {
@@ -655,6 +678,7 @@ class GenericHypergraph {
     } else {
       _hyperedges.emplace_back(hyperedge(_num_hyperedges - 1).firstInvalidEntry(), 0, 0);
     }
+    initializeConnectivitySets();
 
     bool has_hyperedge_weights = false;
     if (hyperedge_weights != nullptr) {
@@ -699,6 +723,7 @@ class GenericHypergraph {
     _threshold_marked(2),
     _hypernodes(),
     _hyperedges(),
+    _incident_nets(),
     _incidence_array(),
     _communities(),
     _fixed_vertices(nullptr),
@@ -706,7 +731,11 @@ class GenericHypergraph {
     _part_info(_k),
     _pins_in_part(),
     _connectivity_sets(),
-    _hes_not_containing_u() { }
+    _hes_not_containing_u(),
+    _snapshot_part_id(),
+    _nodes_moved_since_snapshot(),
+    _partition_snapshot_active(false),
+    _concurrent_contractions(nullptr) { }
 
   GenericHypergraph(GenericHypergraph&&) = default;
   GenericHypergraph& operator= (GenericHypergraph&&) = default;
@@ -737,7 +766,7 @@ class GenericHypergraph {
     for (HypernodeID i = 0; i < _num_hypernodes; ++i) {
       if (!hypernode(i).isDisabled()) {
         LOG << "hypernode" << i
-            << ": degree=" << hypernode(i).size()
+            << ": degree=" << _incident_nets.size(i)
             << "weight=" << hypernode(i).weight();
       }
     }
@@ -790,6 +819,36 @@ class GenericHypergraph {
     printHyperedges();
   }
 
+  /*!
+   * Adds the memory consumption of all data structures of the hypergraph
+   * as children to the memory tree node parent.
+   */
+  void memoryConsumption(MemoryTreeNode* parent) const {
+    ASSERT(parent != nullptr);
+    MemoryTreeNode* hypergraph_node = parent->addChild("Hypergraph");
+    hypergraph_node->addChild("Hypernodes", _hypernodes.capacity() * sizeof(Hypernode));
+    hypergraph_node->addChild("Hyperedges", _hyperedges.capacity() * sizeof(Hyperedge));
+    hypergraph_node->addChild("Incidence Array",
+                              _incidence_array.capacity() * sizeof(VertexID));
+    hypergraph_node->addChild("Incident Nets", _incident_nets.memoryConsumption());
+    hypergraph_node->addChild("Pins in Part", _pins_in_part.memoryConsumption());
+    hypergraph_node->addChild("Connectivity Sets", _connectivity_sets.memoryConsumption());
+
+    MemoryTreeNode* misc_node = hypergraph_node->addChild("Miscellaneous");
+    misc_node->addChild("Communities", _communities.capacity() * sizeof(PartitionID));
+    misc_node->addChild("Part Info", _part_info.capacity() * sizeof(PartInfo));
+    misc_node->addChild("Fixed Vertices",
+                        (_fixed_vertices != nullptr ?
+                         2 * static_cast<size_t>(_num_hypernodes) * sizeof(HypernodeID) : 0) +
+                        _fixed_vertex_part_id.capacity() * sizeof(PartitionID));
+    misc_node->addChild("Uncontraction Flags", _hes_not_containing_u.memoryConsumption());
+    misc_node->addChild("Hyperedge Locks", _concurrent_contractions != nullptr ?
+                        static_cast<size_t>(_num_hyperedges) * sizeof(std::atomic<bool>) : 0);
+    misc_node->addChild("Partition Snapshot",
+                        _snapshot_part_id.capacity() * sizeof(PartitionID) +
+                        _nodes_moved_since_snapshot.capacity() * sizeof(HypernodeID));
+  }
+
   /*!
    * Debug information:
    * Print the current state of hyperedge e. For valid hyperedges, this includes
@@ -838,8 +897,7 @@ class GenericHypergraph {
   // ! Returns a for-each iterator-pair to loop over the set of incident hyperedges of hypernode u.
   std::pair<IncidenceIterator, IncidenceIterator> incidentEdges(const HypernodeID u) const {
     ASSERT(!hypernode(u).isDisabled(), "Hypernode" << u << "is disabled");
-    return std::make_pair(hypernode(u).incidentNets().cbegin(),
-                          hypernode(u).incidentNets().cend());
+    return std::make_pair(_incident_nets.cbegin(u), _incident_nets.cend(u));
   }
 
   // ! Returns a for-each iterator-pair to loop over the set pins of hyperedge e.
@@ -882,8 +940,8 @@ class GenericHypergraph {
     }
   }
 
-  // ! Returns a reference to the connectivity set of hyperedge he.
-  const typename ConnectivitySets<PartitionID, HyperedgeID>::ConnectivitySet&
+  // ! Returns a view on the connectivity set of hyperedge he.
+  typename ConnectivitySets<PartitionID, HyperedgeID>::ConnectivitySet
   connectivitySet(const HyperedgeID he) const {
     ASSERT(!hyperedge(he).isDisabled(), "Hyperedge" << he << "is disabled");
     return _connectivity_sets[he];
@@ -905,7 +963,7 @@ class GenericHypergraph {
    *
    */
   Memento contract(const HypernodeID u, const HypernodeID v) {
-    using std::swap;
+    ASSERT(!_partition_snapshot_active, "Partition snapshot has to be released before (un)contracting");
     ASSERT(!hypernode(u).isDisabled(), "Hypernode" << u << "is disabled");
     ASSERT(!hypernode(v).isDisabled(), "Hypernode" << v << "is disabled");
     ASSERT(partID(u) == partID(v), "Hypernodes" << u << "&" << v << "are in different parts: "
@@ -931,43 +989,12 @@ class GenericHypergraph {
       }
     }
 
-    for (const HyperedgeID he : hypernode(v).incidentNets()) {
-      const HypernodeID pins_begin = hyperedge(he).firstEntry();
-      const HypernodeID pins_end = hyperedge(he).firstInvalidEntry();
-      HypernodeID slot_of_u = pins_end - 1;
-      HypernodeID last_pin_slot = pins_end - 1;
-
-      for (HypernodeID pin_iter = pins_begin; pin_iter != last_pin_slot; ++pin_iter) {
-        const HypernodeID pin = _incidence_array[pin_iter];
-        if (pin == v) {
-          swap(_incidence_array[pin_iter], _incidence_array[last_pin_slot]);
-          --pin_iter;
-        } else if (pin == u) {
-          slot_of_u = pin_iter;
-        }
-      }
-
-      ASSERT(_incidence_array[last_pin_slot] == v, "v is not last entry in adjacency array!");
-
-      if (slot_of_u != last_pin_slot) {
-        // Case 1:
-        // Hyperedge e contains both u and v. Thus we don't need to connect u to e and
-        // can just cut off the last entry in the edge array of e that now contains v.
-        DBG << V(he) << ": Case 1";
-        edgeHash(he) -= math::hash(v);
-        hyperedge(he).decrementSize();
-        if (partID(v) != kInvalidPartition) {
-          decrementPinCountInPart(he, partID(v));
-        }
+    // Case 2 operations append to the incident nets of u, which might relocate the
+    // incidence storage. Therefore we access the incident nets of v via their index.
+    const auto& incident_hes_of_v = _incident_nets[v];
+    for (size_t incident_hes_it = 0; incident_hes_it != incident_hes_of_v.size(); ++incident_hes_it) {
+      if (contractIncidentNet(u, v, incident_hes_of_v[incident_hes_it])) {
         --_current_num_pins;
-      } else {
-        DBG << V(he) << ": Case 2";
-        // Case 2:
-        // Hyperedge e does not contain u. Therefore we  have to connect e to the representative u.
-        // This reuses the pin slot of v in e's incidence array (i.e. last_pin_slot!)
-        edgeHash(he) -= math::hash(v);
-        edgeHash(he) += math::hash(u);
-        connectHyperedgeToRepresentative(he, u);
       }
     }
     hypernode(v).disable();
@@ -975,6 +1002,108 @@ class GenericHypergraph {
     return Memento { u, v };
   }
 
+  /*!
+   * Prepares the hypergraph for concurrent contractions via contractConcurrently().
+   * Until endConcurrentContractions() is called, currentNumNodes() and currentNumPins()
+   * are not updated. The hyperedge locks are allocated by the first call and reused
+   * afterwards, such that rounds of few contractions do not cost O(m) each.
+   */
+  void beginConcurrentContractions() {
+    if (!_concurrent_contractions) {
+      _concurrent_contractions = std::make_unique<ConcurrentContractionState>(_num_hyperedges);
+    }
+    ASSERT(!_concurrent_contractions->active, "Concurrent contractions already started");
+    _concurrent_contractions->active = true;
+  }
+
+  /*!
+   * Must be called after all threads finished their concurrent contractions.
+   * Updates the number of hypernodes and pins. All hyperedge locks are released
+   * at this point, since each contraction releases its locks before returning.
+   */
+  void endConcurrentContractions() {
+    ASSERT(_concurrent_contractions && _concurrent_contractions->active,
+           "Concurrent contractions not started");
+    ConcurrentContractionState& state = *_concurrent_contractions;
+    _current_num_hypernodes -= state.num_contractions.exchange(0);
+    _current_num_pins -= state.num_removed_pins.exchange(0);
+    state.timestamp = 0;
+    state.active = false;
+  }
+
+  /*!
+   * Thread-safe version of contract(u, v). Several threads may contract disjoint vertex
+   * pairs at the same time, i.e., each hypernode may be part of at most one concurrent
+   * contraction.
+   *
+   * A contraction only modifies the hyperedges incident to v, the incident nets of u
+   * and the hypernodes u and v. Therefore, the hyperedges incident to v are locked in
+   * increasing order of their ids (to avoid deadlocks) and are only released after the
+   * contraction is finished. Since conflicting contractions are serialized this way,
+   * the returned timestamps define a valid sequential order of all concurrent
+   * contractions: Reverting the mementos in decreasing order of their timestamps
+   * restores the original hypergraph.
+   *
+   * Only incident net storages that support concurrent appends for different
+   * hypernodes (i.e., IncidentNetVectors) can be used.
+   *
+   * \param u Representative hypernode that will remain in the hypergraph
+   * \param v Contraction partner that will be removed from the hypergraph
+   * \return Memento and timestamp of the contraction
+   */
+  std::pair<Memento, size_t> contractConcurrently(const HypernodeID u, const HypernodeID v) {
+    static_assert(IncidentNetStorage::kSupportsConcurrentAppends,
+                  "Incident net storage does not support concurrent contractions");
+    ASSERT(_concurrent_contractions && _concurrent_contractions->active,
+           "Concurrent contractions not started");
+    ASSERT(!_partition_snapshot_active, "Partition snapshot has to be released before (un)contracting");
+    ASSERT(!hypernode(u).isDisabled(), "Hypernode" << u << "is disabled");
+    ASSERT(!hypernode(v).isDisabled(), "Hypernode" << v << "is disabled");
+    ASSERT(partID(u) == partID(v), "Hypernodes" << u << "&" << v << "are in different parts: "
+                                                << partID(u) << "&" << partID(v));
+    ASSERT(!isFixedVertex(v) || isFixedVertex(u),
+           "Hypernode " << v << " is a fixed vertex and has to be the representive of the contraction");
+    ConcurrentContractionState& state = *_concurrent_contractions;
+
+    DBG << "concurrently contracting (" << u << "," << v << ")";
+
+    hypernode(u).setWeight(hypernode(u).weight() + hypernode(v).weight());
+    if (isFixedVertex(u)) {
+      std::lock_guard<std::mutex> lock(state.fixed_vertex_mutex);
+      if (!isFixedVertex(v)) {
+        _part_info[fixedVertexPartID(u)].fixed_vertex_weight += hypernode(v).weight();
+        _fixed_vertex_total_weight += hypernode(v).weight();
+      } else {
+        ASSERT(_fixed_vertices, "Fixed Vertices data structure not initialized");
+        _fixed_vertices->remove(v);
+      }
+    }
+
+    // The incident nets of v are only accessed by the thread contracting v.
+    // Sorting them establishes a global lock order.
+    auto&& incident_hes_of_v = _incident_nets[v];
+    std::sort(incident_hes_of_v.begin(), incident_hes_of_v.end());
+    for (const HyperedgeID he : incident_hes_of_v) {
+      state.lock(he);
+    }
+
+    HypernodeID num_removed_pins = 0;
+    for (const HyperedgeID he : incident_hes_of_v) {
+      if (contractIncidentNet(u, v, he)) {
+        ++num_removed_pins;
+      }
+    }
+    hypernode(v).disable();
+    const size_t timestamp = state.timestamp++;
+
+    for (const HyperedgeID he : incident_hes_of_v) {
+      state.unlock(he);
+    }
+    state.num_removed_pins += num_removed_pins;
+    ++state.num_contractions;
+    return std::make_pair(Memento { u, v }, timestamp);
+  }
+
   /*!
     * Undoes a contraction operation that was remembered by the memento.
     * If 2-way FM refinement is used, this method also calculates the gain changes
@@ -987,6 +1116,7 @@ class GenericHypergraph {
   template <typename GainChanges>
   void uncontract(const Memento& memento, GainChanges& changes,
                   meta::Int2Type<static_cast<int>(RefinementAlgorithm::twoway_fm)>) {  // NOLINT
+    ASSERT(!_partition_snapshot_active, "Partition snapshot has to be released before (un)contracting");
     ASSERT(!hypernode(memento.u).isDisabled(), "Hypernode" << memento.u << "is disabled");
     ASSERT(hypernode(memento.v).isDisabled(), "Hypernode" << memento.v << "is not invalid");
     ASSERT(changes.representative.size() == 1, V(changes.representative.size()));
@@ -998,7 +1128,7 @@ class GenericHypergraph {
     restoreMemento(memento);
     markIncidentNetsOf(memento.v);
 
-    const auto& incident_hes_of_u = hypernode(memento.u).incidentNets();
+    const auto& incident_hes_of_u = _incident_nets[memento.u];
     size_t incident_hes_end = incident_hes_of_u.size();
 
     for (size_t incident_hes_it = 0; incident_hes_it != incident_hes_end; ++incident_hes_it) {
@@ -1030,8 +1160,8 @@ class GenericHypergraph {
           changes_v -= pinCountInPart(he, partID(memento.u)) == 2 ? edgeWeight(he) : 0;
           ++_current_num_pins;
         } else {
-          std::swap(hypernode(memento.u).incidentNets()[incident_hes_it], hypernode(memento.u).incidentNets().back());
-          hypernode(memento.u).incidentNets().pop_back();
+          std::swap(_incident_nets[memento.u][incident_hes_it], _incident_nets[memento.u].back());
+          _incident_nets[memento.u].pop_back();
           --incident_hes_it;
           --incident_hes_end;
           // Undo case 2 opeations (i.e. Entry of pin v in HE e was reused to store connection to u):
@@ -1085,13 +1215,14 @@ class GenericHypergraph {
   * \param memento Memento remembering the contraction operation that should be reverted
   */
   void uncontract(const Memento& memento) {
+    ASSERT(!_partition_snapshot_active, "Partition snapshot has to be released before (un)contracting");
     ASSERT(!hypernode(memento.u).isDisabled(), "Hypernode" << memento.u << "is disabled");
     ASSERT(hypernode(memento.v).isDisabled(), "Hypernode" << memento.v << "is not invalid");
 
     restoreMemento(memento);
     markIncidentNetsOf(memento.v);
 
-    const auto& incident_hes_of_u = hypernode(memento.u).incidentNets();
+    const auto& incident_hes_of_u = _incident_nets[memento.u];
     size_t incident_hes_end = incident_hes_of_u.size();
 
     for (size_t incident_hes_it = 0; incident_hes_it != incident_hes_end; ++incident_hes_it) {
@@ -1118,8 +1249,8 @@ class GenericHypergraph {
 
           ++_current_num_pins;
         } else {
-          std::swap(hypernode(memento.u).incidentNets()[incident_hes_it], hypernode(memento.u).incidentNets().back());
-          hypernode(memento.u).incidentNets().pop_back();
+          std::swap(_incident_nets[memento.u][incident_hes_it], _incident_nets[memento.u].back());
+          _incident_nets[memento.u].pop_back();
           --incident_hes_it;
           --incident_hes_end;
           // Undo case 2 opeations (i.e. Entry of pin v in HE e was reused to store connection to u):
@@ -1198,6 +1329,10 @@ class GenericHypergraph {
     ASSERT(to < _k && to != kInvalidPartition, "Invalid to_part:" << to);
     ASSERT(from != to, "from part" << from << "==" << to << "part");
     ASSERT(!isFixedVertex(hn), "Hypernode " << hn << " is a fixed vertex");
+    if (_partition_snapshot_active && _snapshot_part_id[hn] == kInvalidPartition) {
+      _snapshot_part_id[hn] = from;
+      _nodes_moved_since_snapshot.push_back(hn);
+    }
     updatePartInfo(hn, from, to);
     for (const HyperedgeID& he : incidentEdges(hn)) {
       const bool no_pins_left_in_source_part = decrementPinCountInPart(he, from);
@@ -1356,12 +1491,10 @@ class GenericHypergraph {
     enableEdge(he);
     resetPartitionPinCounts(he);
     for (const HypernodeID& pin : pins(he)) {
-      ASSERT(std::count(hypernode(pin).incidentNets().begin(),
-                        hypernode(pin).incidentNets().end(), he)
-             == 0,
+      ASSERT(std::count(_incident_nets.cbegin(pin), _incident_nets.cend(pin), he) == 0,
              "HN" << pin << "is already connected to HE" << he);
       DBG << "re-adding pin" << pin << "to HE" << he;
-      hypernode(pin).incidentNets().push_back(he);
+      _incident_nets[pin].push_back(he);
       if (partID(pin) != kInvalidPartition) {
         incrementPinCountInPart(he, partID(pin));
       }
@@ -1382,12 +1515,10 @@ class GenericHypergraph {
     enableEdge(he);
     resetPartitionPinCounts(he);
     for (const HypernodeID& pin : pins(he)) {
-      ASSERT(std::count(hypernode(pin).incidentNets().begin(),
-                        hypernode(pin).incidentNets().end(), he)
-             == 0,
+      ASSERT(std::count(_incident_nets.cbegin(pin), _incident_nets.cend(pin), he) == 0,
              "HN" << pin << "is already connected to HE" << he);
       DBG << "re-adding pin" << pin << "to HE" << he;
-      hypernode(pin).incidentNets().push_back(he);
+      _incident_nets[pin].push_back(he);
       if (partID(pin) != kInvalidPartition) {
         incrementPinCountInPart(he, partID(pin));
       }
@@ -1399,17 +1530,73 @@ class GenericHypergraph {
     }
   }
 
+  /*!
+   * Stores the current partition as snapshot. Afterwards, all hypernodes moved via
+   * changeNodePart() are recorded, such that restorePartitionSnapshot() can revert
+   * the partition in time linear in the number of moved hypernodes.
+   * An existing snapshot is replaced.
+   *
+   * Note that the snapshot only tracks changeNodePart(). It therefore has to be
+   * released before the hypergraph is (un)contracted or repartitioned.
+   */
+  void createPartitionSnapshot() {
+    releasePartitionSnapshot();
+    if (_snapshot_part_id.empty()) {
+      _snapshot_part_id.resize(_num_hypernodes, kInvalidPartition);
+    }
+    _partition_snapshot_active = true;
+  }
+
+  // ! Moves all hypernodes moved since the last snapshot back to their snapshot block.
+  // ! The snapshot remains active afterwards.
+  void restorePartitionSnapshot() {
+    ASSERT(_partition_snapshot_active, "No partition snapshot available");
+    _partition_snapshot_active = false;
+    for (const HypernodeID& hn : _nodes_moved_since_snapshot) {
+      const PartitionID snapshot_part = _snapshot_part_id[hn];
+      if (partID(hn) != snapshot_part) {
+        changeNodePart(hn, partID(hn), snapshot_part);
+      }
+      _snapshot_part_id[hn] = kInvalidPartition;
+    }
+    _nodes_moved_since_snapshot.clear();
+    _partition_snapshot_active = true;
+  }
+
+  // ! Stops recording moves and discards the current snapshot (if any).
+  void releasePartitionSnapshot() {
+    for (const HypernodeID& hn : _nodes_moved_since_snapshot) {
+      _snapshot_part_id[hn] = kInvalidPartition;
+    }
+    _nodes_moved_since_snapshot.clear();
+    _partition_snapshot_active = false;
+  }
+
+  // ! Returns the block of hn at the time the current snapshot was created
+  PartitionID snapshotPartID(const HypernodeID hn) const {
+    ASSERT(_partition_snapshot_active, "No partition snapshot available");
+    return _snapshot_part_id[hn] != kInvalidPartition ? _snapshot_part_id[hn] : partID(hn);
+  }
+
+  // ! Returns all hypernodes that were moved since the current snapshot was created.
+  // ! Hypernodes that were moved back to their snapshot block are also contained.
+  const std::vector<HypernodeID> & nodesMovedSincePartitionSnapshot() const {
+    ASSERT(_partition_snapshot_active, "No partition snapshot available");
+    return _nodes_moved_since_snapshot;
+  }
+
   // ! Resets all partitioning related information
   void resetPartitioning() {
+    releasePartitionSnapshot();
     for (HypernodeID i = 0; i < _num_hypernodes; ++i) {
       hypernode(i).part_id = kInvalidPartition;
       hypernode(i).num_incident_cut_hes = 0;
     }
     std::fill(_part_info.begin(), _part_info.end(), PartInfo());
-    std::fill(_pins_in_part.begin(), _pins_in_part.end(), 0);
+    _pins_in_part.reset();
     for (HyperedgeID i = 0; i < _num_hyperedges; ++i) {
       hyperedge(i).connectivity = 0;
-      _connectivity_sets[i].clear();
+      _connectivity_sets.clear(i);
     }
     // Recalculate fixed vertex part weights
     HyperedgeWeight fixed_vertex_weight = 0;
@@ -1465,9 +1652,9 @@ class GenericHypergraph {
   // internal data structures accordingly.
   void changeK(const PartitionID k) {
     _k = k;
-    _pins_in_part.resize(static_cast<size_t>(_num_hyperedges) * k, 0);
+    _pins_in_part.resize(_num_hyperedges, k);
     _part_info.resize(k, PartInfo());
-    _connectivity_sets.resize(_num_hyperedges);
+    initializeConnectivitySets();
   }
 
   void setType(const Type type) {
@@ -1480,7 +1667,7 @@ class GenericHypergraph {
 
   HyperedgeID nodeDegree(const HypernodeID u) const {
     ASSERT(!hypernode(u).isDisabled(), "Hypernode" << u << "is disabled");
-    return hypernode(u).size();
+    return _incident_nets.size(u);
   }
 
   HypernodeID edgeSize(const HyperedgeID e) const {
@@ -1722,8 +1909,8 @@ class GenericHypergraph {
   HypernodeID pinCountInPart(const HyperedgeID he, const PartitionID id) const {
     ASSERT(!hyperedge(he).isDisabled(), "Hyperedge" << he << "is disabled");
     ASSERT(id < _k && id != kInvalidPartition, "Partition ID" << id << "is out of bounds");
-    ASSERT(_pins_in_part[static_cast<size_t>(he) * _k + id] != kInvalidCount, V(he) << V(id));
-    return _pins_in_part[static_cast<size_t>(he) * _k + id];
+    ASSERT(_pins_in_part.get(he, id) != kInvalidCount, V(he) << V(id));
+    return _pins_in_part.get(he, id);
   }
 
   bool inPart(const HypernodeID hn, const PartitionID b) const {
@@ -1893,12 +2080,9 @@ class GenericHypergraph {
     ASSERT(pinCountInPart(he, id) > 0,
            "HE" << he << "does not have any pins in partition" << id);
     ASSERT(id < _k && id != kInvalidPartition, "Part ID" << id << "out of bounds!");
-    ASSERT(_pins_in_part[static_cast<size_t>(he) * _k + id] > 0, "invalid decrease");
-    const size_t offset = static_cast<size_t>(he) * _k + id;
-    _pins_in_part[offset] -= 1;
-    const bool connectivity_decreased = _pins_in_part[offset] == 0;
+    const bool connectivity_decreased = _pins_in_part.decrement(he, id) == 0;
     if (connectivity_decreased) {
-      _connectivity_sets[he].remove(id);
+      _connectivity_sets.remove(he, id);
       hyperedge(he).connectivity -= 1;
     }
     return connectivity_decreased;
@@ -1911,12 +2095,10 @@ class GenericHypergraph {
            "HE" << he << ": pin_count[" << id << "]=" << pinCountInPart(he, id)
                 << "edgesize=" << edgeSize(he));
     ASSERT(id < _k && id != kInvalidPartition, "Part ID" << id << "out of bounds!");
-    const size_t offset = static_cast<size_t>(he) * _k + id;
-    _pins_in_part[offset] += 1;
-    const bool connectivity_increased = _pins_in_part[offset] == 1;
+    const bool connectivity_increased = _pins_in_part.increment(he, id) == 1;
     if (connectivity_increased) {
       hyperedge(he).connectivity += 1;
-      _connectivity_sets[he].add(id);
+      _connectivity_sets.add(he, id);
     }
     return connectivity_increased;
   }
@@ -1925,19 +2107,15 @@ class GenericHypergraph {
   void invalidatePartitionPinCounts(const HyperedgeID he) {
     ASSERT(hyperedge(he).isDisabled(),
            "Invalidation of pin counts only allowed for disabled hyperedges");
-    for (PartitionID part = 0; part < _k; ++part) {
-      _pins_in_part[static_cast<size_t>(he) * _k + part] = kInvalidCount;
-    }
+    _pins_in_part.invalidate(he);
     hyperedge(he).connectivity = 0;
-    _connectivity_sets[he].clear();
+    _connectivity_sets.clear(he);
   }
 
   // ! Resets the number of pins in each block to zero.
   void resetPartitionPinCounts(const HyperedgeID he) {
     ASSERT(!hyperedge(he).isDisabled(), "Hyperedge" << he << "is disabled");
-    for (PartitionID part = 0; part < _k; ++part) {
-      _pins_in_part[static_cast<size_t>(he) * _k + part] = 0;
-    }
+    _pins_in_part.reset(he);
   }
 
   void enableEdge(const HyperedgeID e) {
@@ -1975,6 +2153,53 @@ class GenericHypergraph {
     *pin_end = memento.v;
   }
 
+  /*!
+   * Contracts v into u with respect to the hyperedge he incident to v.
+   * Returns true, if he contained both u and v, i.e., if the pin v was removed from he.
+   */
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE bool contractIncidentNet(const HypernodeID u,
+                                                           const HypernodeID v,
+                                                           const HyperedgeID he) {
+    using std::swap;
+    const HypernodeID pins_begin = hyperedge(he).firstEntry();
+    const HypernodeID pins_end = hyperedge(he).firstInvalidEntry();
+    HypernodeID slot_of_u = pins_end - 1;
+    HypernodeID last_pin_slot = pins_end - 1;
+
+    for (HypernodeID pin_iter = pins_begin; pin_iter != last_pin_slot; ++pin_iter) {
+      const HypernodeID pin = _incidence_array[pin_iter];
+      if (pin == v) {
+        swap(_incidence_array[pin_iter], _incidence_array[last_pin_slot]);
+        --pin_iter;
+      } else if (pin == u) {
+        slot_of_u = pin_iter;
+      }
+    }
+
+    ASSERT(_incidence_array[last_pin_slot] == v, "v is not last entry in adjacency array!");
+
+    if (slot_of_u != last_pin_slot) {
+      // Case 1:
+      // Hyperedge e contains both u and v. Thus we don't need to connect u to e and
+      // can just cut off the last entry in the edge array of e that now contains v.
+      DBG << V(he) << ": Case 1";
+      edgeHash(he) -= math::hash(v);
+      hyperedge(he).decrementSize();
+      if (partID(v) != kInvalidPartition) {
+        decrementPinCountInPart(he, partID(v));
+      }
+      return true;
+    }
+    DBG << V(he) << ": Case 2";
+    // Case 2:
+    // Hyperedge e does not contain u. Therefore we  have to connect e to the representative u.
+    // This reuses the pin slot of v in e's incidence array (i.e. last_pin_slot!)
+    edgeHash(he) -= math::hash(v);
+    edgeHash(he) += math::hash(u);
+    connectHyperedgeToRepresentative(he, u);
+    return false;
+  }
+
   /*!
    * Connect hyperedge e to representative hypernode u.
    * If first_call is true, the method appends the old incidence structure of
@@ -1993,7 +2218,38 @@ class GenericHypergraph {
     // that u is now connected to e and add the edge (u,e) to indicate this conection also from
     // the hypernode's point of view.
     _incidence_array[hyperedge(e).firstInvalidEntry() - 1] = u;
-    hypernode(u).incidentNets().push_back(e);
+    _incident_nets[u].push_back(e);
+  }
+
+  // ! Allocates empty connectivity sets. Since hyperedges never grow beyond their
+  // ! initial size, the connectivity set of each hyperedge is bounded by the size of its
+  // ! slot in the incidence array. Requires the sentinel hyperedge.
+  void initializeConnectivitySets() {
+    _connectivity_sets.initialize(_num_hyperedges, _k, [&](const HyperedgeID he) {
+        return _hyperedges[static_cast<size_t>(he) + 1].firstEntry() - hyperedge(he).firstEntry();
+      });
+  }
+
+  /*!
+   * Initializes the incident nets of all hypernodes based on the pins stored in
+   * _incidence_array. The incident nets of each hypernode are sorted in increasing
+   * order of their hyperedge ids.
+   */
+  void buildIncidentNets() {
+    std::vector<HyperedgeID> degrees(_num_hypernodes, 0);
+    for (HyperedgeID he = 0; he < _num_hyperedges; ++he) {
+      for (VertexID pin_index = hyperedge(he).firstEntry();
+           pin_index < hyperedge(he).firstInvalidEntry(); ++pin_index) {
+        ++degrees[_incidence_array[pin_index]];
+      }
+    }
+    _incident_nets.initialize(degrees);
+    for (HyperedgeID he = 0; he < _num_hyperedges; ++he) {
+      for (VertexID pin_index = hyperedge(he).firstEntry();
+           pin_index < hyperedge(he).firstInvalidEntry(); ++pin_index) {
+        _incident_nets[_incidence_array[pin_index]].push_back(he);
+      }
+    }
   }
 
   KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void markIncidentNetsOf(const HypernodeID v) {
@@ -2038,15 +2294,16 @@ class GenericHypergraph {
     using std::swap;
     ASSERT(!hypernode(hn).isDisabled());
 
-    auto begin = hypernode(hn).incidentNets().begin();
-    ASSERT(hypernode(hn).size() > 0);
-    auto last_entry = hypernode(hn).incidentNets().end() - 1;
+    auto&& incident_nets = _incident_nets[hn];
+    auto begin = incident_nets.begin();
+    ASSERT(incident_nets.size() > 0);
+    auto last_entry = incident_nets.end() - 1;
     while (*begin != he) {
       ++begin;
     }
-    ASSERT(begin < hypernode(hn).incidentNets().end());
+    ASSERT(begin < incident_nets.end());
     swap(*begin, *last_entry);
-    hypernode(hn).incidentNets().pop_back();
+    incident_nets.pop_back();
   }
 
 
@@ -2132,8 +2389,9 @@ class GenericHypergraph {
   std::vector<Hypernode> _hypernodes;
   // ! The hyperedges of the hypergraph
   std::vector<Hyperedge> _hyperedges;
-  // ! Incidence structure containing the ids of of pins of all hyperedges
-  // ! and the ids of the incident edges of all hypernodes.
+  // ! Incidence structure containing the ids of the incident edges of all hypernodes.
+  IncidentNetStorage _incident_nets;
+  // ! Incidence structure containing the ids of of pins of all hyperedges.
   std::vector<VertexID> _incidence_array;
   // ! Stores the community structure revealed by community detection algorithms.
   // ! If community detection is disabled, all HNs are in the same community.
@@ -2146,7 +2404,7 @@ class GenericHypergraph {
   // ! Weight and size information for all blocks.
   std::vector<PartInfo> _part_info;
   // ! For each hyperedge and each block, _pins_in_part stores the number of pins in that block
-  std::vector<HypernodeID> _pins_in_part;
+  PinCountInPart<HypernodeID, HyperedgeID, PartitionID> _pins_in_part;
   // ! For each hyperedge, _connectivity_sets stores the blocks the hyperedge connects
   ConnectivitySets<PartitionID, HyperedgeID> _connectivity_sets;
 
@@ -2158,6 +2416,14 @@ class GenericHypergraph {
    * v was re-used during contraction.
    */
   FastResetFlagArray<> _hes_not_containing_u;
+  // ! Block of each hypernode at snapshot creation, if it was moved afterwards
+  std::vector<PartitionID> _snapshot_part_id;
+  // ! Hypernodes moved since the snapshot was created
+  std::vector<HypernodeID> _nodes_moved_since_snapshot;
+  // ! True, if changeNodePart() records moves for restorePartitionSnapshot()
+  bool _partition_snapshot_active;
+  // ! Allocated by the first call of beginConcurrentContractions()
+  std::unique_ptr<ConcurrentContractionState> _concurrent_contractions;
 
   template <typename Hypergraph>
   friend std::pair<std::unique_ptr<Hypergraph>,
@@ -2209,11 +2475,12 @@ bool verifyEquivalenceWithoutPartitionInfo(const Hypergraph& expected, const Hyp
   ASSERT(expected._current_num_pins == actual._current_num_pins,
          V(expected._current_num_pins) << V(actual._current_num_pins));
   ASSERT(expected._hypernodes == actual._hypernodes, "Error!");
+  ASSERT(expected._incident_nets == actual._incident_nets, "Error!");
   ASSERT(expected._hyperedges == actual._hyperedges, "Error!");
   ASSERT(expected._communities == actual._communities, "Error!");
 
-  std::vector<unsigned int> expected_incidence_array(expected._incidence_array);
-  std::vector<unsigned int> actual_incidence_array(actual._incidence_array);
+  std::vector<typename Hypergraph::VertexID> expected_incidence_array(expected._incidence_array);
+  std::vector<typename Hypergraph::VertexID> actual_incidence_array(actual._incidence_array);
   std::sort(expected_incidence_array.begin(), expected_incidence_array.end());
   std::sort(actual_incidence_array.begin(), actual_incidence_array.end());
 
@@ -2229,6 +2496,7 @@ bool verifyEquivalenceWithoutPartitionInfo(const Hypergraph& expected, const Hyp
          expected._current_num_hyperedges == actual._current_num_hyperedges &&
          expected._current_num_pins == actual._current_num_pins &&
          expected._hypernodes == actual._hypernodes &&
+         expected._incident_nets == actual._incident_nets &&
          expected._hyperedges == actual._hyperedges &&
          expected._communities == actual._communities &&
          expected_incidence_array == actual_incidence_array;
@@ -2341,11 +2609,10 @@ reindex(const Hypergraph& hypergraph) {
 
   ASSERT(reindexed_hypergraph->_incidence_array.size() == num_pins);
   reindexed_hypergraph->_incidence_array.resize(num_pins);
-  reindexed_hypergraph->_pins_in_part.resize(static_cast<size_t>(num_hyperedges) * hypergraph._k);
+  reindexed_hypergraph->_pins_in_part.initialize(num_hyperedges, hypergraph._k,
+                                                 hypergraph._pins_in_part.maxValue());
   reindexed_hypergraph->_hes_not_containing_u.setSize(num_hyperedges);
 
-  reindexed_hypergraph->_connectivity_sets.initialize(num_hyperedges);
-
   for (HypernodeID i = 0; i < num_hypernodes - 1; ++i) {
     reindexed_hypergraph->hypernode(i).setWeight(hypergraph.nodeWeight(reindexed_to_original[i]));
     reindexed_hypergraph->_total_weight += reindexed_hypergraph->hypernode(i).weight();
@@ -2356,11 +2623,7 @@ reindex(const Hypergraph& hypergraph) {
   reindexed_hypergraph->_total_weight +=
     reindexed_hypergraph->hypernode(num_hypernodes - 1).weight();
 
-  for (const HyperedgeID& he : reindexed_hypergraph->edges()) {
-    for (const HypernodeID& pin : reindexed_hypergraph->pins(he)) {
-      reindexed_hypergraph->hypernode(pin).incidentNets().push_back(he);
-    }
-  }
+  reindexed_hypergraph->buildIncidentNets();
 
   reindexed_hypergraph->_part_info.resize(reindexed_hypergraph->_k);
   for (const HypernodeID& hn : reindexed_hypergraph->nodes()) {
@@ -2377,6 +2640,7 @@ reindex(const Hypergraph& hypergraph) {
     reindexed_hypergraph->_hyperedges.emplace_back(
       reindexed_hypergraph->hyperedge(num_hyperedges - 1).firstInvalidEntry(), 0, 0);
   }
+  reindexed_hypergraph->initializeConnectivitySets();
 
   return std::make_pair(std::move(reindexed_hypergraph), reindexed_to_original);
 }
@@ -2477,7 +2741,6 @@ static void setupInternalStructure(const Hypergraph& reference,
                                    const typename Hypergraph::HypernodeID num_pins,
                                    const typename Hypergraph::HyperedgeID num_hyperedges) {
   using HypernodeID = typename Hypergraph::HypernodeID;
-  using HyperedgeID = typename Hypergraph::HyperedgeID;
   subhypergraph._k = new_k;
   subhypergraph._num_pins = num_pins;
   subhypergraph._current_num_hypernodes = num_hypernodes;
@@ -2487,12 +2750,9 @@ static void setupInternalStructure(const Hypergraph& reference,
 
   ASSERT(subhypergraph._incidence_array.size() == num_pins);
   subhypergraph._incidence_array.resize(static_cast<size_t>(num_pins));
-  subhypergraph._pins_in_part.resize(static_cast<size_t>(num_hyperedges) *
-                                     static_cast<size_t>(new_k));
+  subhypergraph._pins_in_part.initialize(num_hyperedges, new_k, reference._pins_in_part.maxValue());
   subhypergraph._hes_not_containing_u.setSize(num_hyperedges);
 
-  subhypergraph._connectivity_sets.initialize(num_hyperedges);
-
   subhypergraph._part_info.resize(new_k);
 
   subhypergraph._hypernodes.resize(num_hypernodes);
@@ -2519,11 +2779,7 @@ static void setupInternalStructure(const Hypergraph& reference,
     reference.nodeWeight(mapping[num_hypernodes - 1]));
   subhypergraph._total_weight += subhypergraph.hypernode(num_hypernodes - 1).weight();
 
-  for (const HyperedgeID& he : subhypergraph.edges()) {
-    for (const HypernodeID& pin : subhypergraph.pins(he)) {
-      subhypergraph.hypernode(pin).incidentNets().push_back(he);
-    }
-  }
+  subhypergraph.buildIncidentNets();
 
   // sentinel for peeks during uncontraction
   if (num_hyperedges == 0) {
@@ -2532,6 +2788,7 @@ static void setupInternalStructure(const Hypergraph& reference,
     subhypergraph._hyperedges.emplace_back(
       subhypergraph.hyperedge(num_hyperedges - 1).firstInvalidEntry(), 0, 0);
   }
+  subhypergraph.initializeConnectivitySets();
 }
 
 
@@ -0,0 +1,406 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2018 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "kahypar/macros.h"
+#include "kahypar/meta/mandatory.h"
+
+namespace kahypar {
+namespace ds {
+/*!
+ * Storage backends for the incident nets I(v) of all hypernodes of a GenericHypergraph.
+ *
+ * Both backends expose the same interface: operator[] returns a handle to the
+ * incident nets of a single hypernode that supports size(), operator[], back(),
+ * push_back() and pop_back(). Iterators returned by cbegin(hn)/cend(hn) are
+ * std::vector<HyperedgeID>::const_iterators in both cases.
+ */
+
+/*!
+ * Each hypernode owns its own std::vector of incident nets.
+ * This is the classical representation used by KaHyPar.
+ */
+template <typename HypernodeID = Mandatory,
+          typename HyperedgeID = Mandatory>
+class IncidentNetVectors {
+ public:
+  using IncidentNets = std::vector<HyperedgeID>;
+  using Iterator = typename std::vector<HyperedgeID>::const_iterator;
+
+  // ! Incident nets of different hypernodes can be modified concurrently.
+  static constexpr bool kSupportsConcurrentAppends = true;
+
+  IncidentNetVectors() :
+    _incident_nets() { }
+
+  IncidentNetVectors(const IncidentNetVectors&) = delete;
+  IncidentNetVectors& operator= (const IncidentNetVectors&) = delete;
+
+  IncidentNetVectors(IncidentNetVectors&&) = default;
+  IncidentNetVectors& operator= (IncidentNetVectors&&) = default;
+
+  ~IncidentNetVectors() = default;
+
+  // ! Creates an empty incident net list with capacity degrees[hn] for each hypernode hn.
+  void initialize(const std::vector<HyperedgeID>& degrees) {
+    _incident_nets.clear();
+    _incident_nets.resize(degrees.size());
+    for (size_t hn = 0; hn < degrees.size(); ++hn) {
+      _incident_nets[hn].reserve(degrees[hn]);
+    }
+  }
+
+  IncidentNets& operator[] (const HypernodeID hn) {
+    ASSERT(hn < _incident_nets.size(), V(hn));
+    return _incident_nets[hn];
+  }
+
+  const IncidentNets& operator[] (const HypernodeID hn) const {
+    ASSERT(hn < _incident_nets.size(), V(hn));
+    return _incident_nets[hn];
+  }
+
+  Iterator cbegin(const HypernodeID hn) const {
+    return _incident_nets[hn].cbegin();
+  }
+
+  Iterator cend(const HypernodeID hn) const {
+    return _incident_nets[hn].cend();
+  }
+
+  HyperedgeID size(const HypernodeID hn) const {
+    return _incident_nets[hn].size();
+  }
+
+  // ! Number of bytes allocated by the storage
+  size_t memoryConsumption() const {
+    size_t size = _incident_nets.capacity() * sizeof(IncidentNets);
+    for (const IncidentNets& incident_nets : _incident_nets) {
+      size += incident_nets.capacity() * sizeof(HyperedgeID);
+    }
+    return size;
+  }
+
+  // ! Two storages are equal if all hypernodes have the same set of incident nets.
+  bool operator== (const IncidentNetVectors& other) const {
+    if (_incident_nets.size() != other._incident_nets.size()) {
+      return false;
+    }
+    for (size_t hn = 0; hn < _incident_nets.size(); ++hn) {
+      if (_incident_nets[hn].size() != other._incident_nets[hn].size() ||
+          !std::is_permutation(_incident_nets[hn].begin(), _incident_nets[hn].end(),
+                               other._incident_nets[hn].begin())) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+ private:
+  std::vector<IncidentNets> _incident_nets;
+};
+
+/*!
+ * Compressed (CSR-like) representation: The incident nets of all hypernodes are stored
+ * in one contiguous array. Each hypernode owns a slot [begin, begin + capacity) in this
+ * array, of which the first size entries are in use.
+ *
+ * Initially, the slots are packed according to the hypernode degrees. If a push_back
+ * exceeds the capacity of a slot (e.g., because a contraction connected new nets to the
+ * representative), the slot is either extended in place (if it is the last slot of the
+ * array) or moved to a new block with at least doubled capacity. If pop_back() shrinks
+ * a slot to at most a quarter of its capacity, the upper half of the slot is released.
+ * Released blocks are kept in one free list per capacity class (i.e., per power of two)
+ * and are reused by later moves. Since released blocks are never merged, the array is
+ * compacted before a move if more than half of it consists of released blocks. Thus,
+ * repeated contractions and uncontractions do not increase the size of the array beyond
+ * a constant factor of the capacity in use.
+ *
+ * Note that moving a slot may reallocate the underlying array and thereby invalidates
+ * all iterators obtained via cbegin()/cend().
+ */
+template <typename HypernodeID = Mandatory,
+          typename HyperedgeID = Mandatory>
+class IncidentNetArray {
+ private:
+  struct Slot {
+    size_t begin;
+    HyperedgeID size;
+    HyperedgeID capacity;
+  };
+
+  struct Block {
+    size_t begin;
+    HyperedgeID capacity;
+  };
+
+  template <typename Array, typename Reference>
+  class Handle {
+ public:
+    Handle(Array& array, const HypernodeID hn) :
+      _array(array),
+      _hn(hn) { }
+
+    HyperedgeID size() const {
+      return _array._slots[_hn].size;
+    }
+
+    bool empty() const {
+      return size() == 0;
+    }
+
+    Reference operator[] (const size_t i) const {
+      ASSERT(i < size(), V(i) << V(size()));
+      return _array._incident_nets[_array._slots[_hn].begin + i];
+    }
+
+    Reference back() const {
+      ASSERT(!empty());
+      return operator[] (size() - 1);
+    }
+
+    auto begin() const {
+      return _array._incident_nets.begin() + _array._slots[_hn].begin;
+    }
+
+    auto end() const {
+      return begin() + size();
+    }
+
+    void push_back(const HyperedgeID he) const {
+      _array.push_back(_hn, he);
+    }
+
+    void pop_back() const {
+      ASSERT(!empty());
+      _array.pop_back(_hn);
+    }
+
+ private:
+    Array& _array;
+    const HypernodeID _hn;
+  };
+
+ public:
+  using IncidentNets = Handle<IncidentNetArray, HyperedgeID&>;
+  using ConstIncidentNets = Handle<const IncidentNetArray, const HyperedgeID&>;
+  using Iterator = typename std::vector<HyperedgeID>::const_iterator;
+
+  // ! Appending to a slot might relocate it within the shared array.
+  static constexpr bool kSupportsConcurrentAppends = false;
+
+  IncidentNetArray() :
+    _slots(),
+    _incident_nets(),
+    _free_blocks(),
+    _num_free_entries(0) { }
+
+  IncidentNetArray(const IncidentNetArray&) = delete;
+  IncidentNetArray& operator= (const IncidentNetArray&) = delete;
+
+  IncidentNetArray(IncidentNetArray&&) = default;
+  IncidentNetArray& operator= (IncidentNetArray&&) = default;
+
+  ~IncidentNetArray() = default;
+
+  // ! Creates an empty slot with capacity degrees[hn] for each hypernode hn.
+  void initialize(const std::vector<HyperedgeID>& degrees) {
+    _slots.clear();
+    _slots.resize(degrees.size());
+    size_t begin = 0;
+    for (size_t hn = 0; hn < degrees.size(); ++hn) {
+      _slots[hn] = Slot { begin, 0, degrees[hn] };
+      begin += degrees[hn];
+    }
+    _incident_nets.clear();
+    _incident_nets.resize(begin);
+    _free_blocks.clear();
+    _num_free_entries = 0;
+  }
+
+  IncidentNets operator[] (const HypernodeID hn) {
+    ASSERT(hn < _slots.size(), V(hn));
+    return IncidentNets(*this, hn);
+  }
+
+  ConstIncidentNets operator[] (const HypernodeID hn) const {
+    ASSERT(hn < _slots.size(), V(hn));
+    return ConstIncidentNets(*this, hn);
+  }
+
+  Iterator cbegin(const HypernodeID hn) const {
+    return _incident_nets.cbegin() + _slots[hn].begin;
+  }
+
+  Iterator cend(const HypernodeID hn) const {
+    return _incident_nets.cbegin() + _slots[hn].begin + _slots[hn].size;
+  }
+
+  HyperedgeID size(const HypernodeID hn) const {
+    return _slots[hn].size;
+  }
+
+  // ! Number of entries of the underlying array, including released blocks
+  size_t numEntries() const {
+    return _incident_nets.size();
+  }
+
+  // ! Number of bytes allocated by the storage, including released blocks
+  size_t memoryConsumption() const {
+    size_t free_blocks = _free_blocks.capacity() * sizeof(std::vector<Block>);
+    for (const std::vector<Block>& blocks : _free_blocks) {
+      free_blocks += blocks.capacity() * sizeof(Block);
+    }
+    return _slots.capacity() * sizeof(Slot) + _incident_nets.capacity() * sizeof(HyperedgeID) +
+           free_blocks;
+  }
+
+  // ! Two storages are equal if all hypernodes have the same set of incident nets.
+  bool operator== (const IncidentNetArray& other) const {
+    if (_slots.size() != other._slots.size()) {
+      return false;
+    }
+    for (size_t hn = 0; hn < _slots.size(); ++hn) {
+      if (_slots[hn].size != other._slots[hn].size ||
+          !std::is_permutation(cbegin(hn), cend(hn), other.cbegin(hn))) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+ private:
+  void push_back(const HypernodeID hn, const HyperedgeID he) {
+    Slot& slot = _slots[hn];
+    if (slot.size == slot.capacity) {
+      grow(slot);
+    }
+    _incident_nets[slot.begin + slot.size] = he;
+    ++slot.size;
+  }
+
+  void pop_back(const HypernodeID hn) {
+    Slot& slot = _slots[hn];
+    --slot.size;
+    if (slot.capacity > 1 && slot.size <= slot.capacity / 4) {
+      const HyperedgeID new_capacity = slot.capacity / 2;
+      release(Block { slot.begin + new_capacity, slot.capacity - new_capacity });
+      slot.capacity = new_capacity;
+    }
+  }
+
+  void grow(Slot& slot) {
+    HyperedgeID new_capacity = 1;
+    while (new_capacity < 2 * slot.capacity) {
+      new_capacity *= 2;
+    }
+    if (_num_free_entries > _incident_nets.size() / 2) {
+      compact();
+    }
+    if (slot.begin + slot.capacity == _incident_nets.size()) {
+      // last slot of the array can be extended in place
+      _incident_nets.resize(slot.begin + new_capacity);
+    } else {
+      const Block block = allocate(new_capacity);
+      std::copy(_incident_nets.begin() + slot.begin,
+                _incident_nets.begin() + slot.begin + slot.size,
+                _incident_nets.begin() + block.begin);
+      release(Block { slot.begin, slot.capacity });
+      slot.begin = block.begin;
+      new_capacity = block.capacity;
+    }
+    slot.capacity = new_capacity;
+  }
+
+  // ! Returns a block with at least the given capacity, which has to be a power of two
+  Block allocate(const HyperedgeID capacity) {
+    const size_t capacity_class = capacityClass(capacity);
+    if (capacity_class < _free_blocks.size() && !_free_blocks[capacity_class].empty()) {
+      const Block block = _free_blocks[capacity_class].back();
+      _free_blocks[capacity_class].pop_back();
+      _num_free_entries -= block.capacity;
+      ASSERT(block.capacity >= capacity, V(block.capacity) << V(capacity));
+      return block;
+    }
+    const size_t begin = _incident_nets.size();
+    _incident_nets.resize(begin + capacity);
+    return Block { begin, capacity };
+  }
+
+  void release(const Block& block) {
+    if (block.capacity == 0) {
+      return;
+    }
+    if (block.begin + block.capacity == _incident_nets.size()) {
+      _incident_nets.resize(block.begin);
+      return;
+    }
+    const size_t capacity_class = capacityClass(block.capacity);
+    if (capacity_class >= _free_blocks.size()) {
+      _free_blocks.resize(capacity_class + 1);
+    }
+    _free_blocks[capacity_class].push_back(block);
+    _num_free_entries += block.capacity;
+  }
+
+  // ! Packs all slots in the order of their hypernodes and drops all released blocks.
+  void compact() {
+    size_t num_entries = 0;
+    for (const Slot& slot : _slots) {
+      num_entries += slot.capacity;
+    }
+    std::vector<HyperedgeID> incident_nets(num_entries);
+    size_t begin = 0;
+    for (Slot& slot : _slots) {
+      std::copy(_incident_nets.begin() + slot.begin,
+                _incident_nets.begin() + slot.begin + slot.size,
+                incident_nets.begin() + begin);
+      slot.begin = begin;
+      begin += slot.capacity;
+    }
+    _incident_nets.swap(incident_nets);
+    _free_blocks.clear();
+    _num_free_entries = 0;
+  }
+
+  // ! Blocks of capacity class i have a capacity in [2^i, 2^(i+1))
+  static size_t capacityClass(HyperedgeID capacity) {
+    ASSERT(capacity > 0);
+    size_t capacity_class = 0;
+    while (capacity > 1) {
+      capacity >>= 1;
+      ++capacity_class;
+    }
+    return capacity_class;
+  }
+
+  std::vector<Slot> _slots;
+  std::vector<HyperedgeID> _incident_nets;
+  std::vector<std::vector<Block> > _free_blocks;
+  size_t _num_free_entries;
+};
+}  // namespace ds
+}  // namespace kahypar
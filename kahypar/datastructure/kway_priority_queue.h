@@ -86,6 +86,16 @@ class KWayPriorityQueue {
     return _num_entries;
   }
 
+  // ! Number of bytes allocated by all heaps and the index structures
+  size_t memoryConsumption() const {
+    size_t size = _mapping.capacity() * sizeof(IndexPartMapping) +
+                  _ties.capacity() * sizeof(size_t);
+    for (const Queue& queue : _queues) {
+      size += sizeof(Queue) + queue.memoryConsumption();
+    }
+    return size;
+  }
+
   KAHYPAR_ATTRIBUTE_ALWAYS_INLINE bool empty(const PartitionID part) const {
     ASSERT(static_cast<unsigned int>(part) < _queues.size(), "Invalid" << V(part));
     return isUnused(part);
@@ -0,0 +1,204 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2018 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "kahypar/macros.h"
+#include "kahypar/meta/mandatory.h"
+
+namespace kahypar {
+namespace ds {
+/*!
+ * Stores the number of pins of each hyperedge in each block.
+ *
+ * Instead of using a full HypernodeID for each of the |E| * k counters, the counters
+ * are bit-packed into 64-bit words. Each counter uses the smallest power of two bits
+ * that is able to represent all counts up to the maximum edge size plus an
+ * additional invalid value (all bits set). Counters of different hyperedges never share
+ * a word, such that all counters of a hyperedge can be reset at once.
+ */
+template <typename HypernodeID = Mandatory,
+          typename HyperedgeID = Mandatory,
+          typename PartitionID = Mandatory>
+class PinCountInPart {
+ private:
+  using Word = std::uint64_t;
+  static constexpr size_t kBitsPerWord = std::numeric_limits<Word>::digits;
+
+ public:
+  // ! Constant returned for invalidated counters
+  static constexpr HypernodeID kInvalidCount = std::numeric_limits<HypernodeID>::max();
+
+  PinCountInPart() :
+    _num_hyperedges(0),
+    _k(0),
+    _max_value(0),
+    _log_bits_per_value(0),
+    _log_values_per_word(0),
+    _words_per_hyperedge(0),
+    _value_mask(0),
+    _counts() { }
+
+  PinCountInPart(const HyperedgeID num_hyperedges, const PartitionID k,
+                 const HypernodeID max_value) :
+    PinCountInPart() {
+    initialize(num_hyperedges, k, max_value);
+  }
+
+  PinCountInPart(const PinCountInPart&) = delete;
+  PinCountInPart& operator= (const PinCountInPart&) = delete;
+
+  PinCountInPart(PinCountInPart&&) = default;
+  PinCountInPart& operator= (PinCountInPart&&) = default;
+
+  ~PinCountInPart() = default;
+
+  // ! Allocates zero-initialized counters that are able to store values in [0, max_value]
+  void initialize(const HyperedgeID num_hyperedges, const PartitionID k,
+                  const HypernodeID max_value) {
+    ASSERT(k > 0, V(k));
+    _num_hyperedges = num_hyperedges;
+    _k = k;
+    _max_value = max_value;
+
+    // The largest representable value is reserved to mark invalid counters.
+    const Word num_values = static_cast<Word>(max_value) + 2;
+    _log_bits_per_value = 0;
+    while ((Word(1) << _log_bits_per_value) < kBitsPerWord &&
+           (Word(1) << (Word(1) << _log_bits_per_value)) < num_values) {
+      ++_log_bits_per_value;
+    }
+    const size_t bits_per_value = size_t(1) << _log_bits_per_value;
+    _log_values_per_word = 0;
+    while ((bits_per_value << (_log_values_per_word + 1)) <= kBitsPerWord) {
+      ++_log_values_per_word;
+    }
+    _value_mask = bits_per_value == kBitsPerWord ?
+                  std::numeric_limits<Word>::max() : (Word(1) << bits_per_value) - 1;
+    _words_per_hyperedge = (static_cast<size_t>(k) + (size_t(1) << _log_values_per_word) - 1)
+                           >> _log_values_per_word;
+    _counts.assign(_words_per_hyperedge * num_hyperedges, 0);
+  }
+
+  // ! Reallocates zero-initialized counters for a different number of blocks.
+  void resize(const HyperedgeID num_hyperedges, const PartitionID k) {
+    initialize(num_hyperedges, k, _max_value);
+  }
+
+  // ! Returns the number of pins of hyperedge he in block id or kInvalidCount
+  HypernodeID get(const HyperedgeID he, const PartitionID id) const {
+    const Word value = (_counts[wordIndex(he, id)] >> shift(id)) & _value_mask;
+    return value == _value_mask ? kInvalidCount : static_cast<HypernodeID>(value);
+  }
+
+  void set(const HyperedgeID he, const PartitionID id, const HypernodeID value) {
+    ASSERT(value <= _max_value || value == kInvalidCount, V(value) << V(_max_value));
+    const Word packed = value == kInvalidCount ? _value_mask : static_cast<Word>(value);
+    Word& word = _counts[wordIndex(he, id)];
+    word = (word & ~(_value_mask << shift(id))) | (packed << shift(id));
+  }
+
+  // ! Increments the counter and returns its new value
+  HypernodeID increment(const HyperedgeID he, const PartitionID id) {
+    ASSERT(get(he, id) < _max_value, V(he) << V(id) << V(get(he, id)) << V(_max_value));
+    const Word word = (_counts[wordIndex(he, id)] += Word(1) << shift(id));
+    return static_cast<HypernodeID>((word >> shift(id)) & _value_mask);
+  }
+
+  // ! Decrements the counter and returns its new value
+  HypernodeID decrement(const HyperedgeID he, const PartitionID id) {
+    ASSERT(get(he, id) > 0 && get(he, id) != kInvalidCount, V(he) << V(id) << V(get(he, id)));
+    const Word word = (_counts[wordIndex(he, id)] -= Word(1) << shift(id));
+    return static_cast<HypernodeID>((word >> shift(id)) & _value_mask);
+  }
+
+  // ! Sets all counters of hyperedge he to zero
+  void reset(const HyperedgeID he) {
+    std::fill(hyperedgeBegin(he), hyperedgeBegin(he) + _words_per_hyperedge, 0);
+  }
+
+  // ! Sets all counters of hyperedge he to kInvalidCount
+  void invalidate(const HyperedgeID he) {
+    std::fill(hyperedgeBegin(he), hyperedgeBegin(he) + _words_per_hyperedge,
+              std::numeric_limits<Word>::max());
+  }
+
+  // ! Sets all counters to zero
+  void reset() {
+    std::fill(_counts.begin(), _counts.end(), 0);
+  }
+
+  // ! Number of counters, i.e. |E| * k
+  size_t size() const {
+    return static_cast<size_t>(_num_hyperedges) * _k;
+  }
+
+  size_t bitsPerCounter() const {
+    return size_t(1) << _log_bits_per_value;
+  }
+
+  HypernodeID maxValue() const {
+    return _max_value;
+  }
+
+  // ! Number of bytes allocated for the packed counters
+  size_t memoryConsumption() const {
+    return _counts.capacity() * sizeof(Word);
+  }
+
+  bool operator== (const PinCountInPart& other) const {
+    return _num_hyperedges == other._num_hyperedges && _k == other._k &&
+           _log_bits_per_value == other._log_bits_per_value && _counts == other._counts;
+  }
+
+ private:
+  size_t wordIndex(const HyperedgeID he, const PartitionID id) const {
+    ASSERT(he < _num_hyperedges, V(he) << V(_num_hyperedges));
+    ASSERT(id >= 0 && id < _k, V(id) << V(_k));
+    return static_cast<size_t>(he) * _words_per_hyperedge +
+           (static_cast<size_t>(id) >> _log_values_per_word);
+  }
+
+  size_t shift(const PartitionID id) const {
+    return (static_cast<size_t>(id) & ((size_t(1) << _log_values_per_word) - 1))
+           << _log_bits_per_value;
+  }
+
+  typename std::vector<Word>::iterator hyperedgeBegin(const HyperedgeID he) {
+    return _counts.begin() + static_cast<size_t>(he) * _words_per_hyperedge;
+  }
+
+  HyperedgeID _num_hyperedges;
+  PartitionID _k;
+  HypernodeID _max_value;
+  size_t _log_bits_per_value;
+  size_t _log_values_per_word;
+  size_t _words_per_hyperedge;
+  Word _value_mask;
+  std::vector<Word> _counts;
+};
+}  // namespace ds
+}  // namespace kahypar
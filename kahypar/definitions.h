@@ -30,16 +30,35 @@
 // #define USE_BUCKET_QUEUE
 
 namespace kahypar {
+#ifdef KAHYPAR_USE_64_BIT_IDS
+// IDs and weights for hypergraphs with more than 2^32 pins or large aggregated weights.
+// Note: This has to match the types exported via include/libkahypar.h.
+using HypernodeID = uint64_t;
+using HyperedgeID = uint64_t;
+using HypernodeWeight = int64_t;
+using HyperedgeWeight = int64_t;
+#else
 using HypernodeID = uint32_t;
 using HyperedgeID = uint32_t;
 using HypernodeWeight = int32_t;
 using HyperedgeWeight = int32_t;
+#endif
 using PartitionID = int32_t;
 using Gain = HyperedgeWeight;
 
+#ifdef KAHYPAR_USE_COMPACT_HYPERGRAPH
+// Incident nets of all hypernodes are stored in one contiguous array.
+using Hypergraph = kahypar::ds::GenericHypergraph<HypernodeID,
+                                                  HyperedgeID, HypernodeWeight,
+                                                  HyperedgeWeight, PartitionID,
+                                                  meta::Empty, meta::Empty,
+                                                  ds::IncidentNetArray<HypernodeID,
+                                                                       HyperedgeID> >;
+#else
 using Hypergraph = kahypar::ds::GenericHypergraph<HypernodeID,
                                                   HyperedgeID, HypernodeWeight,
                                                   HyperedgeWeight, PartitionID>;
+#endif
 
 using RatingType = double;
 using HypergraphType = Hypergraph::Type;
@@ -0,0 +1,678 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2018 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "kahypar/definitions.h"
+#include "kahypar/io/hypergraph_statistics.h"
+#include "kahypar/io/memory_mapped_file.h"
+#include "kahypar/utils/parallel_for.h"
+
+namespace kahypar {
+namespace io {
+/*!
+ * Binary hypergraph format:
+ *
+ * The file starts with a binary::Header, followed by the sections
+ *   - hyperedge offsets (num_hyperedges + 1 uint64_t values, CSR representation)
+ *   - pins             (num_pins HypernodeIDs)
+ *   - hyperedge weights (num_hyperedges HyperedgeWeights, optional)
+ *   - hypernode weights (num_hypernodes HypernodeWeights, optional)
+ *   - fixed vertices   (num_hypernodes PartitionIDs, -1 = not fixed, optional)
+ *   - communities      (num_hypernodes PartitionIDs, optional)
+ * Each section is padded to a multiple of 8 bytes. All values are stored in
+ * native byte order, such that the sections can be used directly from a
+ * memory mapping of the file.
+ *
+ * If the compressed_pins section flag is set, the offsets and pins sections are
+ * replaced by
+ *   - block table      (num_blocks + 1 binary::BlockInfo values)
+ *   - encoded pins     (block_table[num_blocks].byte_offset bytes)
+ * Each hyperedge is encoded as varint(size), varint(first pin) followed by the
+ * varint-encoded differences between consecutive pins, which are stored in
+ * ascending order. Hyperedges are grouped into blocks of kEdgesPerBlock
+ * hyperedges that can be decoded independently of each other.
+ */
+namespace binary {
+static constexpr char kMagic[8] = { 'K', 'A', 'H', 'Y', 'P', 'A', 'R', 'B' };
+static constexpr uint32_t kVersion = 2;
+static constexpr size_t kAlignment = 8;
+static constexpr size_t kEdgesPerBlock = static_cast<size_t>(1) << 12;
+
+enum Section : uint32_t {
+  hyperedge_weights = 1,
+  hypernode_weights = 1 << 1,
+  fixed_vertices = 1 << 2,
+  communities = 1 << 3,
+  compressed_pins = 1 << 4
+};
+
+static constexpr uint32_t kKnownSections = hyperedge_weights | hypernode_weights |
+                                           fixed_vertices | communities | compressed_pins;
+
+// ! Start of a block of kEdgesPerBlock compressed hyperedges
+struct BlockInfo {
+  uint64_t byte_offset;
+  uint64_t first_pin;
+};
+
+struct Header {
+  char magic[8];
+  uint32_t version;
+  uint32_t sections;
+  uint32_t id_size;
+  uint32_t weight_size;
+  uint64_t num_hypernodes;
+  uint64_t num_hyperedges;
+  uint64_t num_pins;
+};
+
+static_assert(sizeof(Header) % kAlignment == 0, "Sections have to be aligned");
+
+/*!
+ * Binary partition format: a PartitionHeader followed by num_hypernodes
+ * PartitionIDs in native byte order.
+ */
+static constexpr char kPartitionMagic[8] = { 'K', 'A', 'H', 'Y', 'P', 'A', 'R', 'P' };
+static constexpr uint32_t kPartitionVersion = 1;
+
+struct PartitionHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t id_size;
+  uint64_t num_hypernodes;
+};
+
+static_assert(sizeof(PartitionHeader) % kAlignment == 0, "Partition has to be aligned");
+
+static inline size_t paddedSize(const size_t size_in_bytes) {
+  return (size_in_bytes + kAlignment - 1) / kAlignment * kAlignment;
+}
+
+static inline void writeSection(std::ofstream& out_stream, const void* data,
+                                const size_t size_in_bytes) {
+  static constexpr char padding[kAlignment] = { };
+  out_stream.write(static_cast<const char*>(data), size_in_bytes);
+  out_stream.write(padding, paddedSize(size_in_bytes) - size_in_bytes);
+}
+
+static inline size_t numBlocks(const size_t num_hyperedges) {
+  return (num_hyperedges + kEdgesPerBlock - 1) / kEdgesPerBlock;
+}
+
+static inline void encodeVarint(uint64_t value, std::vector<uint8_t>& out) {
+  while (value >= 0x80) {
+    out.push_back(static_cast<uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  out.push_back(static_cast<uint8_t>(value));
+}
+
+// ! Returns false if [pos, end) does not start with a valid varint
+static inline bool decodeVarint(const uint8_t*& pos, const uint8_t* end, uint64_t& value) {
+  uint64_t result = 0;
+  for (int shift = 0; pos != end && shift < 64; shift += 7) {
+    const uint8_t byte = *pos++;
+    result |= static_cast<uint64_t>(byte & 0x7f) << shift;
+    if ((byte & 0x80) == 0) {
+      value = result;
+      return true;
+    }
+  }
+  return false;
+}
+
+/*!
+ * Decodes num_values varints into out. Differences between consecutive pins
+ * are mostly smaller than 128, i.e., encoded in a single byte. Therefore,
+ * eight bytes are tested at once and decoded without branches if none of
+ * them has its continuation bit set.
+ */
+template <typename T>
+static inline bool decodeVarints(const uint8_t*& pos, const uint8_t* end,
+                                 size_t num_values, T* out) {
+  static constexpr uint64_t kContinuationBits = 0x8080808080808080ULL;
+  while (num_values > 0) {
+    uint64_t word = 0;
+    if (num_values >= 8 && end - pos >= 8 &&
+        (memcpy(&word, pos, sizeof(word)), (word & kContinuationBits) == 0)) {
+      for (size_t i = 0; i < 8; ++i) {
+        out[i] = static_cast<T>(pos[i]);
+      }
+      pos += 8;
+      out += 8;
+      num_values -= 8;
+    } else {
+      uint64_t value = 0;
+      if (!decodeVarint(pos, end, value)) {
+        return false;
+      }
+      *out++ = static_cast<T>(value);
+      --num_values;
+    }
+  }
+  return true;
+}
+}  // namespace binary
+
+/*!
+ * Read-only view on a hypergraph in binary format. All accessors point directly
+ * into the memory mapping of the file, which is kept alive as long as the view.
+ */
+class BinaryHypergraphFile {
+ public:
+  explicit BinaryHypergraphFile(const std::string& filename) :
+    _file(filename),
+    _header(nullptr),
+    _offsets(nullptr),
+    _pins(nullptr),
+    _hyperedge_weights(nullptr),
+    _hypernode_weights(nullptr),
+    _fixed_vertices(nullptr),
+    _communities(nullptr),
+    _blocks(nullptr),
+    _encoded_pins(nullptr),
+    _offset_copy() {
+    if (!_file.isOpen()) {
+      std::cerr << "Error: File not found: " << filename << std::endl;
+      exit(1);
+    }
+    if (!hasBinaryHeader(_file)) {
+      std::cerr << "Error: " << filename << " is not a binary hypergraph file" << std::endl;
+      exit(1);
+    }
+    _header = reinterpret_cast<const binary::Header*>(_file.begin());
+    if (_header->version == 0 || _header->version > binary::kVersion ||
+        (_header->sections & ~binary::kKnownSections) != 0 ||
+        _header->id_size != sizeof(HypernodeID) ||
+        _header->weight_size != sizeof(HypernodeWeight)) {
+      std::cerr << "Error: Binary hypergraph file " << filename << " has version "
+                << _header->version << " with " << 8 * _header->id_size << "-bit IDs and "
+                << 8 * _header->weight_size << "-bit weights, which is not supported by this build"
+                << std::endl;
+      exit(1);
+    }
+
+    const size_t num_hypernodes = _header->num_hypernodes;
+    const size_t num_hyperedges = _header->num_hyperedges;
+    const char* pos = _file.begin() + sizeof(binary::Header);
+    if (hasCompressedPins()) {
+      _blocks = section<binary::BlockInfo>(pos, binary::numBlocks(num_hyperedges) + 1);
+      if (pos > _file.end()) {
+        truncated(filename);
+      }
+      _encoded_pins = reinterpret_cast<const uint8_t*>(pos);
+      pos += binary::paddedSize(_blocks[binary::numBlocks(num_hyperedges)].byte_offset);
+    } else {
+      _offsets = section<uint64_t>(pos, num_hyperedges + 1);
+      _pins = section<HypernodeID>(pos, _header->num_pins);
+    }
+    _hyperedge_weights = optionalSection<HyperedgeWeight>(pos, binary::hyperedge_weights,
+                                                          num_hyperedges);
+    _hypernode_weights = optionalSection<HypernodeWeight>(pos, binary::hypernode_weights,
+                                                          num_hypernodes);
+    _fixed_vertices = optionalSection<PartitionID>(pos, binary::fixed_vertices, num_hypernodes);
+    _communities = optionalSection<PartitionID>(pos, binary::communities, num_hypernodes);
+    if (pos > _file.end() ||
+        (hasCompressedPins() ?
+         _blocks[binary::numBlocks(num_hyperedges)].first_pin :
+         _offsets[num_hyperedges]) != _header->num_pins) {
+      truncated(filename);
+    }
+
+    if (!hasCompressedPins() && sizeof(size_t) != sizeof(uint64_t)) {
+      _offset_copy.assign(_offsets, _offsets + num_hyperedges + 1);
+    }
+  }
+
+  BinaryHypergraphFile(const BinaryHypergraphFile&) = delete;
+  BinaryHypergraphFile& operator= (const BinaryHypergraphFile&) = delete;
+
+  BinaryHypergraphFile(BinaryHypergraphFile&&) = delete;
+  BinaryHypergraphFile& operator= (BinaryHypergraphFile&&) = delete;
+
+  ~BinaryHypergraphFile() = default;
+
+  static bool hasBinaryHeader(const MemoryMappedFile& file) {
+    return file.size() >= sizeof(binary::Header) &&
+           memcmp(file.begin(), binary::kMagic, sizeof(binary::kMagic)) == 0;
+  }
+
+  HypernodeID numHypernodes() const {
+    return _header->num_hypernodes;
+  }
+
+  HyperedgeID numHyperedges() const {
+    return _header->num_hyperedges;
+  }
+
+  HypernodeID numPins() const {
+    return _header->num_pins;
+  }
+
+  // ! If true, the pins have to be decoded via decodePins instead of using indices() and pins()
+  bool hasCompressedPins() const {
+    return (_header->sections & binary::compressed_pins) != 0;
+  }
+
+  const size_t* indices() const {
+    ASSERT(!hasCompressedPins());
+    return _offset_copy.empty() ? reinterpret_cast<const size_t*>(_offsets) : _offset_copy.data();
+  }
+
+  const HypernodeID* pins() const {
+    ASSERT(!hasCompressedPins());
+    return _pins;
+  }
+
+  /*!
+   * Appends the hyperedges of the file to index_vector and edge_vector. Compressed
+   * blocks are decoded in parallel directly into their final position.
+   */
+  void decodePins(HyperedgeIndexVector& index_vector, HyperedgeVector& edge_vector) const {
+    const size_t num_hyperedges = numHyperedges();
+    const size_t first_index = index_vector.size();
+    const size_t first_pin = edge_vector.size();
+    index_vector.resize(first_index + num_hyperedges + /*sentinel*/ 1);
+    edge_vector.resize(first_pin + numPins());
+    index_vector[first_index] = first_pin;
+    if (!hasCompressedPins()) {
+      const size_t* indices = this->indices();
+      std::copy(_pins, _pins + numPins(), edge_vector.begin() + first_pin);
+      for (size_t he = 1; he <= num_hyperedges; ++he) {
+        index_vector[first_index + he] = first_pin + indices[he];
+      }
+      return;
+    }
+
+    // Each thread decodes a consecutive range of blocks
+    struct BlockRange {
+      size_t begin;
+      size_t end;
+      bool valid;
+    };
+    const size_t num_blocks = binary::numBlocks(num_hyperedges);
+    std::vector<BlockRange> ranges(utils::numThreads(num_blocks, 4));
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      ranges[i] = { i * num_blocks / ranges.size(), (i + 1) * num_blocks / ranges.size(), true };
+    }
+    utils::parallelForEach(ranges, [&](BlockRange& range) {
+        for (size_t block = range.begin; block < range.end && range.valid; ++block) {
+          range.valid = decodeBlock(block, first_index, first_pin, index_vector, edge_vector);
+        }
+      });
+    for (const BlockRange& range : ranges) {
+      if (!range.valid) {
+        std::cerr << "Error: Binary hypergraph file contains corrupted pins" << std::endl;
+        exit(1);
+      }
+    }
+  }
+
+  // ! Returns nullptr if the file does not contain hyperedge weights
+  const HyperedgeWeight* hyperedgeWeights() const {
+    return _hyperedge_weights;
+  }
+
+  // ! Returns nullptr if the file does not contain hypernode weights
+  const HypernodeWeight* hypernodeWeights() const {
+    return _hypernode_weights;
+  }
+
+  // ! Returns nullptr if the file does not contain fixed vertices
+  const PartitionID* fixedVertices() const {
+    return _fixed_vertices;
+  }
+
+  // ! Returns nullptr if the file does not contain communities
+  const PartitionID* communities() const {
+    return _communities;
+  }
+
+ private:
+  bool decodeBlock(const size_t block, const size_t first_index, const size_t first_pin,
+                   HyperedgeIndexVector& index_vector, HyperedgeVector& edge_vector) const {
+    const binary::BlockInfo& info = _blocks[block];
+    const binary::BlockInfo& next = _blocks[block + 1];
+    const binary::BlockInfo& sentinel = _blocks[binary::numBlocks(numHyperedges())];
+    if (info.byte_offset > next.byte_offset || next.byte_offset > sentinel.byte_offset ||
+        info.first_pin > next.first_pin || next.first_pin > sentinel.first_pin) {
+      return false;
+    }
+    const uint8_t* pos = _encoded_pins + info.byte_offset;
+    const uint8_t* end = _encoded_pins + next.byte_offset;
+    const size_t first_he = block * binary::kEdgesPerBlock;
+    const size_t last_he = std::min(first_he + binary::kEdgesPerBlock,
+                                    static_cast<size_t>(numHyperedges()));
+    size_t pin = info.first_pin;
+    for (size_t he = first_he; he < last_he; ++he) {
+      uint64_t size = 0;
+      if (!binary::decodeVarint(pos, end, size) || size > next.first_pin - pin) {
+        return false;
+      }
+      HypernodeID* pins = edge_vector.data() + first_pin + pin;
+      if (!binary::decodeVarints(pos, end, size, pins)) {
+        return false;
+      }
+      for (size_t i = 1; i < size; ++i) {
+        const HypernodeID previous = pins[i - 1];
+        pins[i] += previous;
+        if (pins[i] < previous) {
+          return false;
+        }
+      }
+      if (size > 0 && pins[size - 1] >= numHypernodes()) {
+        return false;
+      }
+      pin += size;
+      index_vector[first_index + he + 1] = first_pin + pin;
+    }
+    return pos == end && pin == next.first_pin;
+  }
+
+  static void truncated(const std::string& filename) {
+    std::cerr << "Error: Binary hypergraph file " << filename << " is truncated" << std::endl;
+    exit(1);
+  }
+
+  template <typename T>
+  const T* section(const char*& pos, const size_t num_elements) const {
+    const T* data = reinterpret_cast<const T*>(pos);
+    pos += binary::paddedSize(num_elements * sizeof(T));
+    return data;
+  }
+
+  template <typename T>
+  const T* optionalSection(const char*& pos, const binary::Section section_id,
+                           const size_t num_elements) const {
+    if ((_header->sections & section_id) == 0) {
+      return nullptr;
+    }
+    return section<T>(pos, num_elements);
+  }
+
+  MemoryMappedFile _file;
+  const binary::Header* _header;
+  const uint64_t* _offsets;
+  const HypernodeID* _pins;
+  const HyperedgeWeight* _hyperedge_weights;
+  const HypernodeWeight* _hypernode_weights;
+  const PartitionID* _fixed_vertices;
+  const PartitionID* _communities;
+  const binary::BlockInfo* _blocks;
+  const uint8_t* _encoded_pins;
+  std::vector<size_t> _offset_copy;
+};
+
+static inline bool hasMagic(const std::string& filename, const char (& expected)[8]) {
+  // Binary files have to be memory mapped, so we must not consume the contents of pipes.
+  if (!MemoryMappedFile::isRegularFile(filename)) {
+    return false;
+  }
+  std::ifstream file(filename, std::ios::binary);
+  char magic[sizeof(expected)] = { };
+  return file.read(magic, sizeof(magic)) && memcmp(magic, expected, sizeof(magic)) == 0;
+}
+
+static inline bool isBinaryHypergraphFile(const std::string& filename) {
+  return hasMagic(filename, binary::kMagic);
+}
+
+static inline bool isBinaryPartitionFile(const std::string& filename) {
+  return hasMagic(filename, binary::kPartitionMagic);
+}
+
+// ! Binary counterpart of readHypergraphFile for hMetis files
+static inline void readBinaryHypergraphFile(const std::string& filename,
+                                            HypernodeID& num_hypernodes,
+                                            HyperedgeID& num_hyperedges,
+                                            HyperedgeIndexVector& index_vector,
+                                            HyperedgeVector& edge_vector,
+                                            HyperedgeWeightVector* hyperedge_weights,
+                                            HypernodeWeightVector* hypernode_weights) {
+  const BinaryHypergraphFile file(filename);
+  num_hypernodes = file.numHypernodes();
+  num_hyperedges = file.numHyperedges();
+  file.decodePins(index_vector, edge_vector);
+  if (hyperedge_weights != nullptr && file.hyperedgeWeights() != nullptr) {
+    hyperedge_weights->insert(hyperedge_weights->end(), file.hyperedgeWeights(),
+                              file.hyperedgeWeights() + num_hyperedges);
+  }
+  if (hypernode_weights != nullptr && file.hypernodeWeights() != nullptr) {
+    hypernode_weights->insert(hypernode_weights->end(), file.hypernodeWeights(),
+                              file.hypernodeWeights() + num_hypernodes);
+  }
+}
+
+/*!
+ * Creates a hypergraph from a binary hypergraph file. If the file contains a community
+ * structure, it is set on the hypergraph and additionally copied to communities (if given).
+ */
+static inline Hypergraph createHypergraphFromBinaryFile(const std::string& filename,
+                                                        const PartitionID num_parts,
+                                                        std::shared_future<HypergraphStats>* stats =
+                                                          nullptr,
+                                                        std::vector<ClusterID>* communities =
+                                                          nullptr) {
+  const BinaryHypergraphFile file(filename);
+  HyperedgeIndexVector index_vector;
+  HyperedgeVector edge_vector;
+  if (file.hasCompressedPins()) {
+    file.decodePins(index_vector, edge_vector);
+  }
+  const size_t* indices = file.hasCompressedPins() ? index_vector.data() : file.indices();
+  const HypernodeID* pins = file.hasCompressedPins() ? edge_vector.data() : file.pins();
+  const std::shared_future<HypergraphStats> input_stats =
+    validateHypergraphAsync(file.numHypernodes(), file.numHyperedges(), indices, pins,
+                            file.hyperedgeWeights(), file.hypernodeWeights());
+  exitIfInvalid(input_stats, filename);
+  if (stats != nullptr) {
+    *stats = input_stats;
+  }
+  Hypergraph hypergraph(file.numHypernodes(), file.numHyperedges(), indices, pins,
+                        num_parts, file.hyperedgeWeights(), file.hypernodeWeights());
+  if (file.fixedVertices() != nullptr) {
+    for (const HypernodeID& hn : hypergraph.nodes()) {
+      const PartitionID part = file.fixedVertices()[hn];
+      if (part != -1) {
+        if (part < 0 || part >= num_parts) {
+          std::cerr << "Error: Hypernode " << hn << " of binary hypergraph file " << filename
+                    << " is fixed to block " << part << ", but k = " << num_parts << std::endl;
+          exit(1);
+        }
+        hypergraph.setFixedVertex(hn, part);
+      }
+    }
+  }
+  if (file.communities() != nullptr) {
+    hypergraph.setCommunities(std::vector<PartitionID>(file.communities(),
+                                                       file.communities() + file.numHypernodes()));
+    if (communities != nullptr) {
+      *communities = hypergraph.communities();
+    }
+  }
+  return hypergraph;
+}
+
+/*!
+ * Writes the hypergraph in binary format. If compress_pins is set, the pins of
+ * each hyperedge are sorted and stored delta/varint-encoded.
+ */
+static inline void writeBinaryHypergraphFile(const Hypergraph& hypergraph,
+                                             const std::string& filename,
+                                             const std::vector<PartitionID>* communities = nullptr,
+                                             const bool compress_pins = false) {
+  ASSERT(!filename.empty(), "No filename for binary hypergraph file specified");
+  ALWAYS_ASSERT(!hypergraph.isModified(), "Hypergraph is modified. Reindexing HNs/HEs necessary.");
+  ASSERT(communities == nullptr || communities->size() == hypergraph.initialNumNodes());
+
+  const bool has_hyperedge_weights = hypergraph.type() == HypergraphType::EdgeWeights ||
+                                     hypergraph.type() == HypergraphType::EdgeAndNodeWeights;
+  const bool has_hypernode_weights = hypergraph.type() == HypergraphType::NodeWeights ||
+                                     hypergraph.type() == HypergraphType::EdgeAndNodeWeights;
+
+  binary::Header header = { };
+  memcpy(header.magic, binary::kMagic, sizeof(binary::kMagic));
+  header.version = binary::kVersion;
+  header.sections = 0;
+  if (has_hyperedge_weights) {
+    header.sections |= binary::hyperedge_weights;
+  }
+  if (has_hypernode_weights) {
+    header.sections |= binary::hypernode_weights;
+  }
+  if (hypergraph.containsFixedVertices()) {
+    header.sections |= binary::fixed_vertices;
+  }
+  if (communities != nullptr) {
+    header.sections |= binary::communities;
+  }
+  if (compress_pins) {
+    header.sections |= binary::compressed_pins;
+  }
+  header.id_size = sizeof(HypernodeID);
+  header.weight_size = sizeof(HypernodeWeight);
+  header.num_hypernodes = hypergraph.initialNumNodes();
+  header.num_hyperedges = hypergraph.initialNumEdges();
+  header.num_pins = hypergraph.initialNumPins();
+
+  std::vector<uint64_t> offsets;
+  HyperedgeVector pins;
+  HyperedgeWeightVector hyperedge_weights;
+  offsets.reserve(static_cast<size_t>(hypergraph.initialNumEdges()) + 1);
+  pins.reserve(hypergraph.initialNumPins());
+  offsets.push_back(0);
+  for (const HyperedgeID& he : hypergraph.edges()) {
+    for (const HypernodeID& pin : hypergraph.pins(he)) {
+      pins.push_back(pin);
+    }
+    offsets.push_back(pins.size());
+    hyperedge_weights.push_back(hypergraph.edgeWeight(he));
+  }
+
+  HypernodeWeightVector hypernode_weights;
+  std::vector<PartitionID> fixed_vertices;
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    hypernode_weights.push_back(hypergraph.nodeWeight(hn));
+    fixed_vertices.push_back(hypergraph.isFixedVertex(hn) ? hypergraph.fixedVertexPartID(hn) : -1);
+  }
+
+  std::vector<binary::BlockInfo> blocks;
+  std::vector<uint8_t> encoded_pins;
+  if (compress_pins) {
+    for (size_t he = 0; he < offsets.size() - 1; ++he) {
+      if (he % binary::kEdgesPerBlock == 0) {
+        blocks.push_back({ encoded_pins.size(), offsets[he] });
+      }
+      std::sort(pins.begin() + offsets[he], pins.begin() + offsets[he + 1]);
+      binary::encodeVarint(offsets[he + 1] - offsets[he], encoded_pins);
+      HypernodeID previous = 0;
+      for (size_t i = offsets[he]; i < offsets[he + 1]; ++i) {
+        binary::encodeVarint(pins[i] - previous, encoded_pins);
+        previous = pins[i];
+      }
+    }
+    blocks.push_back({ encoded_pins.size(), pins.size() });
+  }
+
+  std::ofstream out_stream(filename.c_str(), std::ios::binary);
+  out_stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  if (compress_pins) {
+    binary::writeSection(out_stream, blocks.data(), blocks.size() * sizeof(binary::BlockInfo));
+    binary::writeSection(out_stream, encoded_pins.data(), encoded_pins.size());
+  } else {
+    binary::writeSection(out_stream, offsets.data(), offsets.size() * sizeof(uint64_t));
+    binary::writeSection(out_stream, pins.data(), pins.size() * sizeof(HypernodeID));
+  }
+  if (has_hyperedge_weights) {
+    binary::writeSection(out_stream, hyperedge_weights.data(),
+                         hyperedge_weights.size() * sizeof(HyperedgeWeight));
+  }
+  if (has_hypernode_weights) {
+    binary::writeSection(out_stream, hypernode_weights.data(),
+                         hypernode_weights.size() * sizeof(HypernodeWeight));
+  }
+  if (hypergraph.containsFixedVertices()) {
+    binary::writeSection(out_stream, fixed_vertices.data(),
+                         fixed_vertices.size() * sizeof(PartitionID));
+  }
+  if (communities != nullptr) {
+    binary::writeSection(out_stream, communities->data(),
+                         communities->size() * sizeof(PartitionID));
+  }
+  out_stream.close();
+}
+
+static inline void writeBinaryPartitionFile(const Hypergraph& hypergraph,
+                                            const std::string& filename) {
+  ASSERT(!filename.empty(), "No filename for binary partition file specified");
+  binary::PartitionHeader header = { };
+  memcpy(header.magic, binary::kPartitionMagic, sizeof(binary::kPartitionMagic));
+  header.version = binary::kPartitionVersion;
+  header.id_size = sizeof(PartitionID);
+  header.num_hypernodes = hypergraph.initialNumNodes();
+
+  std::vector<PartitionID> partition;
+  partition.reserve(hypergraph.initialNumNodes());
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    partition.push_back(hypergraph.partID(hn));
+  }
+
+  std::ofstream out_stream(filename.c_str(), std::ios::binary);
+  out_stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  binary::writeSection(out_stream, partition.data(), partition.size() * sizeof(PartitionID));
+  out_stream.close();
+}
+
+static inline void readBinaryPartitionFile(const std::string& filename,
+                                           std::vector<PartitionID>& partition) {
+  const MemoryMappedFile file(filename);
+  if (!file.isOpen()) {
+    std::cerr << "Error: File not found: " << filename << std::endl;
+    exit(1);
+  }
+  const binary::PartitionHeader* header = reinterpret_cast<const binary::PartitionHeader*>(
+    file.begin());
+  // The number of hypernodes is checked via division to avoid an overflow of the section size.
+  if (file.size() < sizeof(binary::PartitionHeader) ||
+      memcmp(header->magic, binary::kPartitionMagic, sizeof(binary::kPartitionMagic)) != 0 ||
+      header->version != binary::kPartitionVersion ||
+      header->id_size != sizeof(PartitionID) ||
+      header->num_hypernodes >
+      (file.size() - sizeof(binary::PartitionHeader)) / sizeof(PartitionID)) {
+    std::cerr << "Error: " << filename << " is not a valid binary partition file" << std::endl;
+    exit(1);
+  }
+  const PartitionID* parts = reinterpret_cast<const PartitionID*>(
+    file.begin() + sizeof(binary::PartitionHeader));
+  partition.insert(partition.end(), parts, parts + header->num_hypernodes);
+}
+}  // namespace io
+}  // namespace kahypar
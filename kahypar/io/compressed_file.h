@@ -0,0 +1,361 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2018 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+#ifdef KAHYPAR_USE_ZLIB
+#include <zlib.h>
+#endif
+#ifdef KAHYPAR_USE_ZSTD
+#include <zstd.h>
+#endif
+
+#include "kahypar/io/memory_mapped_file.h"
+#include "kahypar/macros.h"
+
+namespace kahypar {
+namespace io {
+enum class Compression : uint8_t {
+  none,
+  gzip,
+  zstd
+};
+
+static inline Compression detectCompression(const MemoryMappedFile& file) {
+  const unsigned char* data = reinterpret_cast<const unsigned char*>(file.begin());
+  if (file.size() >= 2 && data[0] == 0x1f && data[1] == 0x8b) {
+    return Compression::gzip;
+  }
+  if (file.size() >= 4 && data[0] == 0x28 && data[1] == 0xb5 && data[2] == 0x2f &&
+      data[3] == 0xfd) {
+    return Compression::zstd;
+  }
+  return Compression::none;
+}
+
+static inline std::string toString(const Compression& compression) {
+  switch (compression) {
+    case Compression::none: return std::string("none");
+    case Compression::gzip: return std::string("gzip");
+    case Compression::zstd: return std::string("zstd");
+  }
+  return std::string("UNDEFINED");
+}
+
+/*!
+ * Decompresses a gzip or zstd compressed file in a background thread.
+ * The decompressed contents are handed out in blocks that end at a line
+ * boundary, such that each block can be parsed independently while the
+ * next block is decompressed.
+ */
+class CompressedFileReader {
+ private:
+  static constexpr size_t kBlockSize = static_cast<size_t>(1) << 22;
+  static constexpr size_t kMaxQueuedBlocks = 2;
+
+ public:
+  CompressedFileReader(const MemoryMappedFile& file, const Compression compression) :
+    _file(file),
+    _compression(compression),
+    _mutex(),
+    _block_available(),
+    _space_available(),
+    _blocks(),
+    _finished(false),
+    _stopped(false),
+    _error(),
+    _producer() {
+    ASSERT(compression != Compression::none);
+    _producer = std::thread([this]() {
+        decompress();
+      });
+  }
+
+  CompressedFileReader(const CompressedFileReader&) = delete;
+  CompressedFileReader& operator= (const CompressedFileReader&) = delete;
+
+  CompressedFileReader(CompressedFileReader&&) = delete;
+  CompressedFileReader& operator= (CompressedFileReader&&) = delete;
+
+  ~CompressedFileReader() {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _stopped = true;
+    }
+    _space_available.notify_one();
+    _producer.join();
+  }
+
+  // ! Returns false if all blocks have been read
+  bool nextBlock(std::string& block) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _block_available.wait(lock, [this]() {
+        return !_blocks.empty() || _finished;
+      });
+    if (_blocks.empty()) {
+      if (!_error.empty()) {
+        std::cerr << "Error: " << _error << std::endl;
+        exit(1);
+      }
+      return false;
+    }
+    block = std::move(_blocks.front());
+    _blocks.pop_front();
+    lock.unlock();
+    _space_available.notify_one();
+    return true;
+  }
+
+ private:
+  void decompress() {
+    std::string decompressed;
+    const auto emit = [&](const bool last) {
+        const size_t eol = decompressed.find_last_of('\n');
+        if (last || eol != std::string::npos) {
+          const size_t length = last ? decompressed.size() : eol + 1;
+          std::string block = decompressed.substr(0, length);
+          decompressed.erase(0, length);
+          return push(std::move(block));
+        }
+        return true;
+      };
+
+    switch (_compression) {
+      case Compression::gzip:
+        decompressGzip(decompressed, emit);
+        break;
+      case Compression::zstd:
+        decompressZstd(decompressed, emit);
+        break;
+      default:
+        break;
+    }
+    if (!decompressed.empty() && !failed()) {
+      emit(true);
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _finished = true;
+    _block_available.notify_one();
+  }
+
+  // ! Returns false if the reader was stopped
+  bool push(std::string&& block) {
+    if (block.empty()) {
+      return true;
+    }
+    std::unique_lock<std::mutex> lock(_mutex);
+    _space_available.wait(lock, [this]() {
+        return _blocks.size() < kMaxQueuedBlocks || _stopped;
+      });
+    if (_stopped) {
+      return false;
+    }
+    _blocks.emplace_back(std::move(block));
+    lock.unlock();
+    _block_available.notify_one();
+    return true;
+  }
+
+  bool failed() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return !_error.empty();
+  }
+
+  void fail(const std::string& error) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _error = error;
+  }
+
+  template <typename Emit>
+  void decompressGzip(std::string& decompressed, const Emit& emit) {
+#ifdef KAHYPAR_USE_ZLIB
+    z_stream stream;
+    memset(&stream, 0, sizeof(stream));
+    // 15 + 32: maximum window size with automatic gzip/zlib header detection
+    if (inflateInit2(&stream, 15 + 32) != Z_OK) {
+      fail("Could not initialize gzip decompression");
+      return;
+    }
+    const unsigned char* input = reinterpret_cast<const unsigned char*>(_file.begin());
+    size_t remaining = _file.size();
+    while (true) {
+      if (stream.avail_in == 0 && remaining > 0) {
+        const size_t chunk = std::min(remaining, static_cast<size_t>(1) << 30);
+        stream.next_in = const_cast<Bytef*>(input);
+        stream.avail_in = static_cast<uInt>(chunk);
+        input += chunk;
+        remaining -= chunk;
+      }
+      const size_t old_size = decompressed.size();
+      decompressed.resize(old_size + kBlockSize);
+      stream.next_out = reinterpret_cast<Bytef*>(&decompressed[old_size]);
+      stream.avail_out = static_cast<uInt>(kBlockSize);
+      const int ret = inflate(&stream, Z_NO_FLUSH);
+      decompressed.resize(old_size + kBlockSize - stream.avail_out);
+      const bool input_consumed = stream.avail_in == 0 && remaining == 0;
+      if (ret == Z_BUF_ERROR && input_consumed) {
+        fail("Unexpected end of gzip compressed file");
+        break;
+      } else if (ret != Z_OK && ret != Z_STREAM_END) {
+        fail("Corrupted gzip compressed file");
+        break;
+      }
+      if (ret == Z_STREAM_END) {
+        if (input_consumed) {
+          break;
+        }
+        // concatenated gzip members
+        inflateReset(&stream);
+      }
+      if (decompressed.size() >= kBlockSize && !emit(false)) {
+        break;
+      }
+    }
+    inflateEnd(&stream);
+#else
+    unused(decompressed);
+    unused(emit);
+    fail("KaHyPar was built without gzip support (zlib)");
+#endif
+  }
+
+  template <typename Emit>
+  void decompressZstd(std::string& decompressed, const Emit& emit) {
+#ifdef KAHYPAR_USE_ZSTD
+    ZSTD_DStream* stream = ZSTD_createDStream();
+    ZSTD_initDStream(stream);
+    ZSTD_inBuffer input = { _file.begin(), _file.size(), 0 };
+    size_t ret = 0;
+    while (input.pos < input.size) {
+      const size_t old_size = decompressed.size();
+      decompressed.resize(old_size + kBlockSize);
+      ZSTD_outBuffer output = { &decompressed[old_size], kBlockSize, 0 };
+      ret = ZSTD_decompressStream(stream, &output, &input);
+      decompressed.resize(old_size + output.pos);
+      if (ZSTD_isError(ret)) {
+        fail(std::string("Corrupted zstd compressed file: ") + ZSTD_getErrorName(ret));
+        break;
+      }
+      if (decompressed.size() >= kBlockSize && !emit(false)) {
+        break;
+      }
+    }
+    // flush data buffered by the decoder
+    while (!ZSTD_isError(ret) && ret != 0 && input.pos == input.size) {
+      const size_t old_size = decompressed.size();
+      decompressed.resize(old_size + kBlockSize);
+      ZSTD_outBuffer output = { &decompressed[old_size], kBlockSize, 0 };
+      ret = ZSTD_decompressStream(stream, &output, &input);
+      decompressed.resize(old_size + output.pos);
+      if (output.pos == 0) {
+        fail("Unexpected end of zstd compressed file");
+        break;
+      }
+    }
+    ZSTD_freeDStream(stream);
+#else
+    unused(decompressed);
+    unused(emit);
+    fail("KaHyPar was built without zstd support");
+#endif
+  }
+
+  const MemoryMappedFile& _file;
+  const Compression _compression;
+  std::mutex _mutex;
+  std::condition_variable _block_available;
+  std::condition_variable _space_available;
+  std::deque<std::string> _blocks;
+  bool _finished;
+  bool _stopped;
+  std::string _error;
+  std::thread _producer;
+};
+
+/*!
+ * Calls f(begin, end) for consecutive ranges of complete lines of the file.
+ * Uncompressed files are passed as a single range of the memory mapping,
+ * compressed files are decompressed block-wise in the background.
+ * Iteration stops early if f returns false.
+ *
+ * \return false if the file could not be opened
+ */
+template <typename F>
+static inline bool forEachBlockOfLines(const std::string& filename, const F& f) {
+  const MemoryMappedFile file(filename);
+  if (!file.isOpen()) {
+    return false;
+  }
+  const Compression compression = detectCompression(file);
+  if (compression == Compression::none) {
+    f(file.begin(), file.end());
+  } else {
+    CompressedFileReader reader(file, compression);
+    std::string block;
+    while (reader.nextBlock(block)) {
+      if (!f(static_cast<const char*>(block.data()), block.data() + block.size())) {
+        break;
+      }
+    }
+  }
+  return true;
+}
+
+/*!
+ * Calls f(begin, end) once for the complete contents of the file. Compressed
+ * files are decompressed into memory first.
+ *
+ * \return false if the file could not be opened
+ */
+template <typename F>
+static inline bool withFileContents(const std::string& filename, const F& f) {
+  const MemoryMappedFile file(filename);
+  if (!file.isOpen()) {
+    return false;
+  }
+  const Compression compression = detectCompression(file);
+  if (compression == Compression::none) {
+    f(file.begin(), file.end());
+  } else {
+    std::string contents;
+    std::string block;
+    CompressedFileReader reader(file, compression);
+    while (reader.nextBlock(block)) {
+      contents.append(block);
+    }
+    f(static_cast<const char*>(contents.data()), contents.data() + contents.size());
+  }
+  return true;
+}
+}  // namespace io
+}  // namespace kahypar
@@ -20,16 +20,29 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstring>
 #include <fstream>
+#include <future>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
 #include "kahypar/definitions.h"
+#include "kahypar/io/binary_hypergraph_io.h"
+#include "kahypar/io/compressed_file.h"
+#include "kahypar/io/hypergraph_statistics.h"
+#include "kahypar/io/line_parsing.h"
+#include "kahypar/io/matrix_market_io.h"
+#include "kahypar/io/memory_mapped_file.h"
+#include "kahypar/partition/context_enum_classes.h"
+#include "kahypar/utils/parallel_for.h"
 
 namespace kahypar {
 namespace io {
@@ -51,86 +64,338 @@ static inline void readHGRHeader(std::ifstream& file, HyperedgeID& num_hyperedge
   hypergraph_type = static_cast<HypergraphType>(i);
 }
 
-static inline void readHypergraphFile(const std::string& filename, HypernodeID& num_hypernodes,
-                                      HyperedgeID& num_hyperedges,
-                                      HyperedgeIndexVector& index_vector,
-                                      HyperedgeVector& edge_vector,
-                                      HyperedgeWeightVector* hyperedge_weights = nullptr,
-                                      HypernodeWeightVector* hypernode_weights = nullptr) {
-  ASSERT(!filename.empty(), "No filename for hypergraph file specified");
-  HypergraphType hypergraph_type = HypergraphType::Unweighted;
-  std::ifstream file(filename);
-  if (file) {
-    readHGRHeader(file, num_hyperedges, num_hypernodes, hypergraph_type);
+namespace internal {
+// ! Files are only split into chunks of at least this size for parallel parsing
+static constexpr size_t kMinBytesPerChunk = static_cast<size_t>(1) << 20;
+
+struct HGRChunk {
+  const char* begin = nullptr;
+  const char* end = nullptr;
+  // global index of the first non-comment line of the chunk
+  size_t first_line = 0;
+  size_t num_lines = 0;
+  size_t first_pin = 0;
+  HyperedgeVector pins = { };
+  // end of each hyperedge of the chunk in pins
+  std::vector<size_t> edge_ends = { };
+  HyperedgeID empty_hyperedge = std::numeric_limits<HyperedgeID>::max();
+  // global index of the first line that could not be parsed
+  size_t invalid_line = std::numeric_limits<size_t>::max();
+};
+
+// ! Returns the position of the first line after the header or nullptr if there is no header.
+static inline const char* parseHGRHeader(const char* pos, const char* end,
+                                         HyperedgeID& num_hyperedges,
+                                         HypernodeID& num_hypernodes,
+                                         HypergraphType& hypergraph_type) {
+  while (isCommentLine(pos, end)) {
+    pos = nextLine(pos, end);
+  }
+  if (pos == end) {
+    return nullptr;
+  }
+  const char* eol = endOfLine(pos, end);
+  int type = 0;
+  scanInteger(pos, eol, num_hyperedges);
+  scanInteger(pos, eol, num_hypernodes);
+  scanInteger(pos, eol, type);
+  hypergraph_type = static_cast<HypergraphType>(type);
+  return eol == end ? end : eol + 1;
+}
+
+/*!
+ * Parses the lines following the header of an hMetis file. The lines can be passed
+ * in several consecutive ranges. Each range is split into chunks that are parsed in
+ * parallel into chunk-local pin lists. Afterwards, the chunks are appended to
+ * index_vector and edge_vector using prefix sums over the number of lines and pins
+ * per chunk.
+ */
+class HGRBodyParser {
+ public:
+  HGRBodyParser(const HypernodeID num_hypernodes, const HyperedgeID num_hyperedges,
+                const HypergraphType hypergraph_type, HyperedgeIndexVector& index_vector,
+                HyperedgeVector& edge_vector, HyperedgeWeightVector* hyperedge_weights,
+                HypernodeWeightVector* hypernode_weights, const HypernodeID pin_base = 1) :
+    _num_hypernodes(num_hypernodes),
+    _num_hyperedges(num_hyperedges),
+    _has_hyperedge_weights(hypergraph_type == HypergraphType::EdgeWeights ||
+                           hypergraph_type == HypergraphType::EdgeAndNodeWeights),
+    _pin_base(pin_base),
+    _index_vector(index_vector),
+    _edge_vector(edge_vector),
+    _edge_weights(nullptr),
+    _node_weights(nullptr),
+    _first_index(0),
+    _num_lines(num_hyperedges),
+    _num_parsed_lines(0) {
     ASSERT(hypergraph_type == HypergraphType::Unweighted ||
            hypergraph_type == HypergraphType::EdgeWeights ||
            hypergraph_type == HypergraphType::NodeWeights ||
            hypergraph_type == HypergraphType::EdgeAndNodeWeights,
            "Hypergraph in file has wrong type");
-
-    const bool has_hyperedge_weights = hypergraph_type == HypergraphType::EdgeWeights ||
-                                       hypergraph_type == HypergraphType::EdgeAndNodeWeights ?
-                                       true : false;
     const bool has_hypernode_weights = hypergraph_type == HypergraphType::NodeWeights ||
-                                       hypergraph_type == HypergraphType::EdgeAndNodeWeights ?
-                                       true : false;
-
-    index_vector.reserve(static_cast<size_t>(num_hyperedges) +  /*sentinel*/ 1);
-    index_vector.push_back(edge_vector.size());
-
-    std::string line;
-    for (HyperedgeID i = 0; i < num_hyperedges; ++i) {
-      std::getline(file, line);
-      // skip any comments
-      while (line[0] == '%') {
-        std::getline(file, line);
+                                       hypergraph_type == HypergraphType::EdgeAndNodeWeights;
+
+    if (_has_hyperedge_weights) {
+      if (hyperedge_weights == nullptr) {
+        LOG << "****** ignoring hyperedge weights ******";
+      } else {
+        const size_t first_edge_weight = hyperedge_weights->size();
+        hyperedge_weights->resize(first_edge_weight + num_hyperedges, 1);
+        _edge_weights = hyperedge_weights->data() + first_edge_weight;
+      }
+    }
+    if (has_hypernode_weights) {
+      if (hypernode_weights == nullptr) {
+        LOG << " ****** ignoring hypernode weights ******";
+      } else {
+        const size_t first_node_weight = hypernode_weights->size();
+        hypernode_weights->resize(first_node_weight + num_hypernodes, 1);
+        _node_weights = hypernode_weights->data() + first_node_weight;
+        _num_lines += num_hypernodes;
       }
+    }
+
+    _index_vector.reserve(_index_vector.size() + num_hyperedges +  /*sentinel*/ 1);
+    _index_vector.push_back(_edge_vector.size());
+    _first_index = _index_vector.size();
+  }
 
-      std::istringstream line_stream(line);
-      if (line_stream.peek() == EOF) {
-        std::cerr << "Error: Hyperedge " << i << " is empty" << std::endl;
+  HGRBodyParser(const HGRBodyParser&) = delete;
+  HGRBodyParser& operator= (const HGRBodyParser&) = delete;
+
+  HGRBodyParser(HGRBodyParser&&) = delete;
+  HGRBodyParser& operator= (HGRBodyParser&&) = delete;
+
+  ~HGRBodyParser() = default;
+
+  // ! Parses the complete lines in [begin, end). Returns false if no further lines are needed.
+  bool parse(const char* begin, const char* end, const size_t num_chunks) {
+    std::vector<HGRChunk> chunks(std::max(num_chunks, static_cast<size_t>(1)));
+    splitAtLines(begin, end, chunks);
+
+    utils::parallelForEach(chunks, [](HGRChunk& chunk) {
+        for (const char* line = chunk.begin; line != chunk.end; line = nextLine(line, chunk.end)) {
+          if (!isCommentLine(line, chunk.end)) {
+            ++chunk.num_lines;
+          }
+        }
+      });
+
+    for (HGRChunk& chunk : chunks) {
+      chunk.first_line = _num_parsed_lines;
+      _num_parsed_lines += chunk.num_lines;
+    }
+
+    utils::parallelForEach(chunks, [&](HGRChunk& chunk) {
+        parseChunk(chunk);
+      });
+
+    for (const HGRChunk& chunk : chunks) {
+      if (chunk.empty_hyperedge != std::numeric_limits<HyperedgeID>::max()) {
+        std::cerr << "Error: Hyperedge " << chunk.empty_hyperedge << " is empty" << std::endl;
         exit(1);
       }
-
-      if (has_hyperedge_weights) {
-        HyperedgeWeight edge_weight;
-        line_stream >> edge_weight;
-        if (hyperedge_weights == nullptr) {
-          LOG << "****** ignoring hyperedge weights ******";
+      if (chunk.invalid_line != std::numeric_limits<size_t>::max()) {
+        if (chunk.invalid_line < _num_hyperedges) {
+          std::cerr << "Error: Hyperedge " << chunk.invalid_line
+                    << " contains an invalid hypernode ID or weight" << std::endl;
         } else {
-          ASSERT(hyperedge_weights != nullptr, "Hypergraph has hyperedge weights");
-          hyperedge_weights->push_back(edge_weight);
+          std::cerr << "Error: Weight of hypernode " << chunk.invalid_line - _num_hyperedges
+                    << " is invalid" << std::endl;
         }
+        exit(1);
       }
-      HypernodeID pin;
-      while (line_stream >> pin) {
-        // Hypernode IDs start from 0
-        --pin;
-        ASSERT(pin < num_hypernodes, "Invalid hypernode ID");
-        edge_vector.push_back(pin);
-      }
-      index_vector.push_back(edge_vector.size());
     }
 
-    if (has_hypernode_weights) {
-      if (hypernode_weights == nullptr) {
-        LOG << " ****** ignoring hypernode weights ******";
-      } else {
-        ASSERT(hypernode_weights != nullptr, "Hypergraph has hypernode weights");
-        for (HypernodeID i = 0; i < num_hypernodes; ++i) {
-          std::getline(file, line);
-          // skip any comments
-          while (line[0] == '%') {
-            std::getline(file, line);
+    size_t num_pins = 0;
+    for (HGRChunk& chunk : chunks) {
+      chunk.first_pin = num_pins;
+      num_pins += chunk.pins.size();
+    }
+
+    const size_t first_pin = _edge_vector.size();
+    _index_vector.resize(_first_index + std::min(_num_parsed_lines,
+                                                 static_cast<size_t>(_num_hyperedges)));
+    _edge_vector.resize(first_pin + num_pins);
+
+    utils::parallelForEach(chunks, [&](HGRChunk& chunk) {
+        std::copy(chunk.pins.begin(), chunk.pins.end(),
+                  _edge_vector.begin() + first_pin + chunk.first_pin);
+        const size_t first_edge_index = _first_index + chunk.first_line;
+        for (size_t i = 0; i < chunk.edge_ends.size(); ++i) {
+          _index_vector[first_edge_index + i] = first_pin + chunk.first_pin + chunk.edge_ends[i];
+        }
+        HyperedgeVector().swap(chunk.pins);
+      });
+
+    return _num_parsed_lines < _num_lines;
+  }
+
+  // ! Exits if less hyperedges than specified in the header were parsed
+  void finalize() const {
+    if (_num_parsed_lines < _num_hyperedges) {
+      std::cerr << "Error: Hyperedge " << _num_parsed_lines << " is empty" << std::endl;
+      exit(1);
+    }
+  }
+
+ private:
+  void parseChunk(HGRChunk& chunk) const {
+    size_t line_index = chunk.first_line;
+    const char* line = chunk.begin;
+    while (line != chunk.end && line_index < _num_lines) {
+      const char* eol = endOfLine(line, chunk.end);
+      if (!isCommentLine(line, eol)) {
+        const char* pos = line;
+        if (line_index < _num_hyperedges) {
+          if (skipWhitespace(pos, eol) == eol) {
+            chunk.empty_hyperedge = line_index;
+            return;
+          }
+          HyperedgeWeight edge_weight = 1;
+          if (_has_hyperedge_weights) {
+            if (!scanInteger(pos, eol, edge_weight)) {
+              chunk.invalid_line = line_index;
+              return;
+            }
+            if (_edge_weights != nullptr) {
+              _edge_weights[line_index] = edge_weight;
+            }
+          }
+          HypernodeID pin = 0;
+          while (scanInteger(pos, eol, pin)) {
+            if (pin < _pin_base || pin - _pin_base >= _num_hypernodes) {
+              chunk.invalid_line = line_index;
+              return;
+            }
+            // Hypernode IDs start from 0
+            chunk.pins.push_back(pin - _pin_base);
           }
-          std::istringstream line_stream(line);
-          HypernodeWeight node_weight;
-          line_stream >> node_weight;
-          hypernode_weights->push_back(node_weight);
+          // Anything left on the line is neither a pin nor whitespace (e.g. an overflowing ID).
+          if (skipWhitespace(pos, eol) != eol) {
+            chunk.invalid_line = line_index;
+            return;
+          }
+          chunk.edge_ends.push_back(chunk.pins.size());
+        } else {
+          HypernodeWeight node_weight = 1;
+          if (!scanInteger(pos, eol, node_weight) && skipWhitespace(pos, eol) != eol) {
+            chunk.invalid_line = line_index;
+            return;
+          }
+          _node_weights[line_index - _num_hyperedges] = node_weight;
         }
+        ++line_index;
       }
+      line = eol == chunk.end ? chunk.end : eol + 1;
     }
-    file.close();
+  }
+
+  const HypernodeID _num_hypernodes;
+  const HyperedgeID _num_hyperedges;
+  const bool _has_hyperedge_weights;
+  // ID of the first hypernode in the file
+  const HypernodeID _pin_base;
+  HyperedgeIndexVector& _index_vector;
+  HyperedgeVector& _edge_vector;
+  HyperedgeWeight* _edge_weights;
+  HypernodeWeight* _node_weights;
+  // position of the end of the first hyperedge in _index_vector
+  size_t _first_index;
+  // number of lines after the header that have to be parsed
+  size_t _num_lines;
+  size_t _num_parsed_lines;
+};
+
+// ! Parses the contents of an hMetis file in memory using num_chunks threads.
+static inline void parseHypergraph(const char* begin, const char* end, const size_t num_chunks,
+                                   HypernodeID& num_hypernodes, HyperedgeID& num_hyperedges,
+                                   HyperedgeIndexVector& index_vector,
+                                   HyperedgeVector& edge_vector,
+                                   HyperedgeWeightVector* hyperedge_weights,
+                                   HypernodeWeightVector* hypernode_weights) {
+  HypergraphType hypergraph_type = HypergraphType::Unweighted;
+  num_hypernodes = 0;
+  num_hyperedges = 0;
+  const char* body = parseHGRHeader(begin, end, num_hyperedges, num_hypernodes, hypergraph_type);
+  HGRBodyParser parser(num_hypernodes, num_hyperedges, hypergraph_type, index_vector,
+                       edge_vector, hyperedge_weights, hypernode_weights);
+  if (body != nullptr) {
+    parser.parse(body, end, num_chunks);
+  }
+  parser.finalize();
+}
+
+// ! Partition files are only split into chunks of at least this many nodes for parallel writing
+static constexpr size_t kMinNodesPerChunk = static_cast<size_t>(1) << 18;
+
+struct PartitionChunk {
+  HypernodeID begin = 0;
+  HypernodeID end = 0;
+  std::string buffer = { };
+};
+
+// ! Writes the decimal representation of value to pos and returns the position after it.
+static inline char* formatInteger(const PartitionID value, char* pos) {
+  uint32_t abs_value = static_cast<uint32_t>(value);
+  if (value < 0) {
+    *pos++ = '-';
+    abs_value = 0u - abs_value;
+  }
+  char digits[10];
+  int num_digits = 0;
+  do {
+    digits[num_digits++] = static_cast<char>('0' + abs_value % 10);
+    abs_value /= 10;
+  } while (abs_value != 0);
+  while (num_digits > 0) {
+    *pos++ = digits[--num_digits];
+  }
+  return pos;
+}
+}  // namespace internal
+
+static inline void readHypergraphFile(const std::string& filename, HypernodeID& num_hypernodes,
+                                      HyperedgeID& num_hyperedges,
+                                      HyperedgeIndexVector& index_vector,
+                                      HyperedgeVector& edge_vector,
+                                      HyperedgeWeightVector* hyperedge_weights = nullptr,
+                                      HypernodeWeightVector* hypernode_weights = nullptr) {
+  ASSERT(!filename.empty(), "No filename for hypergraph file specified");
+  if (isBinaryHypergraphFile(filename)) {
+    readBinaryHypergraphFile(filename, num_hypernodes, num_hyperedges, index_vector, edge_vector,
+                             hyperedge_weights, hypernode_weights);
+    return;
+  }
+  HypergraphType hypergraph_type = HypergraphType::Unweighted;
+  num_hypernodes = 0;
+  num_hyperedges = 0;
+  std::unique_ptr<internal::HGRBodyParser> parser;
+  // Compressed files are parsed block by block while the next block is decompressed.
+  const bool file_found = forEachBlockOfLines(filename, [&](const char* begin, const char* end) {
+      if (parser == nullptr) {
+        begin = internal::parseHGRHeader(begin, end, num_hyperedges, num_hypernodes,
+                                         hypergraph_type);
+        if (begin == nullptr) {
+          // the block only contains comments
+          return true;
+        }
+        parser = std::make_unique<internal::HGRBodyParser>(num_hypernodes, num_hyperedges,
+                                                           hypergraph_type, index_vector,
+                                                           edge_vector, hyperedge_weights,
+                                                           hypernode_weights);
+      }
+      return parser->parse(begin, end, utils::numThreads(end - begin, internal::kMinBytesPerChunk));
+    });
+  if (file_found) {
+    if (parser == nullptr) {
+      parser = std::make_unique<internal::HGRBodyParser>(num_hypernodes, num_hyperedges,
+                                                         hypergraph_type, index_vector,
+                                                         edge_vector, hyperedge_weights,
+                                                         hypernode_weights);
+    }
+    parser->finalize();
   } else {
     std::cerr << "Error: File not found: " << std::endl;
   }
@@ -175,20 +440,177 @@ static inline void readHypergraphFile(const std::string& filename,
 }
 
 
+/*!
+ * Reads a hypergraph in PaToH format. The header consists of the index base,
+ * the number of cells (hypernodes), nets (hyperedges) and pins, followed by an
+ * optional weighting scheme (1: cell weights, 2: net costs, 3: both) and number
+ * of constraints, which has to be 1. The net lines are parsed in parallel.
+ */
+static inline void readPaToHFile(const std::string& filename, HypernodeID& num_hypernodes,
+                                 HyperedgeID& num_hyperedges,
+                                 HyperedgeIndexVector& index_vector,
+                                 HyperedgeVector& edge_vector,
+                                 HyperedgeWeightVector* hyperedge_weights,
+                                 HypernodeWeightVector* hypernode_weights) {
+  const bool file_found = withFileContents(filename, [&](const char* begin, const char* end) {
+      const char* pos = begin;
+      while (internal::isCommentLine(pos, end)) {
+        pos = internal::nextLine(pos, end);
+      }
+      const char* eol = internal::endOfLine(pos, end);
+      HypernodeID base = 0;
+      size_t num_pins = 0;
+      int weighting_scheme = 0;
+      int num_constraints = 1;
+      if (!internal::scanInteger(pos, eol, base) ||
+          !internal::scanInteger(pos, eol, num_hypernodes) ||
+          !internal::scanInteger(pos, eol, num_hyperedges) ||
+          !internal::scanInteger(pos, eol, num_pins) || base > 1) {
+        std::cerr << "Error: " << filename << " has no valid PaToH header" << std::endl;
+        exit(1);
+      }
+      internal::scanInteger(pos, eol, weighting_scheme);
+      internal::scanInteger(pos, eol, num_constraints);
+      if (num_constraints != 1) {
+        std::cerr << "Error: PaToH files with multiple constraints are not supported" << std::endl;
+        exit(1);
+      }
+
+      // the cell weights follow the net lines
+      const char* body = internal::nextLine(eol, end);
+      const char* cell_weights = body;
+      for (HyperedgeID line = 0; line < num_hyperedges && cell_weights != end;
+           cell_weights = internal::nextLine(cell_weights, end)) {
+        if (!internal::isCommentLine(cell_weights, end)) {
+          ++line;
+        }
+      }
+
+      const size_t first_pin = edge_vector.size();
+      internal::HGRBodyParser parser(num_hypernodes, num_hyperedges,
+                                     (weighting_scheme & 2) ? HypergraphType::EdgeWeights :
+                                     HypergraphType::Unweighted,
+                                     index_vector, edge_vector, hyperedge_weights, nullptr, base);
+      parser.parse(body, cell_weights, utils::numThreads(cell_weights - body,
+                                                         internal::kMinBytesPerChunk));
+      parser.finalize();
+      if (edge_vector.size() - first_pin != num_pins) {
+        std::cerr << "Error: PaToH file contains " << edge_vector.size() - first_pin
+                  << " instead of " << num_pins << " pins" << std::endl;
+        exit(1);
+      }
+
+      if (weighting_scheme & 1) {
+        if (hypernode_weights == nullptr) {
+          LOG << " ****** ignoring hypernode weights ******";
+        } else {
+          const size_t first_node_weight = hypernode_weights->size();
+          hypernode_weights->resize(first_node_weight + num_hypernodes, 1);
+          pos = cell_weights;
+          for (HypernodeID hn = 0; hn < num_hypernodes; ++hn) {
+            while (internal::isCommentLine(internal::skipWhitespace(pos, end), end)) {
+              pos = internal::nextLine(internal::skipWhitespace(pos, end), end);
+            }
+            internal::scanInteger(pos, end, (*hypernode_weights)[first_node_weight + hn]);
+          }
+        }
+      }
+    });
+  if (!file_found) {
+    std::cerr << "Error: File not found: " << filename << std::endl;
+    exit(1);
+  }
+}
+
+static inline bool hasExtension(std::string filename, const std::string& extension) {
+  for (const std::string compression_extension : { ".gz", ".zst", ".zstd" }) {
+    if (filename.size() > compression_extension.size() &&
+        filename.compare(filename.size() - compression_extension.size(),
+                         compression_extension.size(), compression_extension) == 0) {
+      filename.resize(filename.size() - compression_extension.size());
+    }
+  }
+  return filename.size() > extension.size() &&
+         filename.compare(filename.size() - extension.size(), extension.size(), extension) == 0;
+}
+
+// ! Detects the format of a hypergraph file by its header and file extension
+static inline InputFormat detectInputFormat(const std::string& filename) {
+  if (isBinaryHypergraphFile(filename)) {
+    return InputFormat::binary;
+  }
+  static constexpr char kMatrixMarketBanner[] = "%%MatrixMarket";
+  char banner[sizeof(kMatrixMarketBanner) - 1] = { };
+  if (hasExtension(filename, ".mtx") ||
+      (MemoryMappedFile::isRegularFile(filename) &&
+       std::ifstream(filename, std::ios::binary).read(banner, sizeof(banner)) &&
+       memcmp(banner, kMatrixMarketBanner, sizeof(banner)) == 0)) {
+    return InputFormat::matrix_market;
+  }
+  if (hasExtension(filename, ".patoh") || hasExtension(filename, ".u")) {
+    return InputFormat::patoh;
+  }
+  return InputFormat::hmetis;
+}
+
+/*!
+ * Creates a hypergraph from a file in hMetis, KaHyPar binary, MatrixMarket or
+ * PaToH format. Sparse matrices are converted using the given model.
+ * If stats is given, it receives the statistics of the input, which are computed
+ * in the background while the hypergraph is constructed. If communities is given,
+ * it receives the community structure stored in a binary hypergraph file (if any).
+ */
 static inline Hypergraph createHypergraphFromFile(const std::string& filename,
-                                                  const PartitionID num_parts) {
+                                                  const PartitionID num_parts,
+                                                  InputFormat format,
+                                                  const MatrixModel model,
+                                                  std::shared_future<HypergraphStats>* stats =
+                                                    nullptr,
+                                                  std::vector<ClusterID>* communities = nullptr) {
+  if (format == InputFormat::automatic) {
+    format = detectInputFormat(filename);
+  }
+  if (format == InputFormat::binary) {
+    return createHypergraphFromBinaryFile(filename, num_parts, stats, communities);
+  }
   HypernodeID num_hypernodes;
   HyperedgeID num_hyperedges;
   HyperedgeIndexVector index_vector;
   HyperedgeVector edge_vector;
   HypernodeWeightVector hypernode_weights;
   HyperedgeWeightVector hyperedge_weights;
-  readHypergraphFile(filename, num_hypernodes, num_hyperedges,
-                     index_vector, edge_vector, &hyperedge_weights, &hypernode_weights);
+  switch (format) {
+    case InputFormat::matrix_market:
+      readMatrixMarketFile(filename, model, num_hypernodes, num_hyperedges,
+                           index_vector, edge_vector, &hypernode_weights);
+      break;
+    case InputFormat::patoh:
+      readPaToHFile(filename, num_hypernodes, num_hyperedges,
+                    index_vector, edge_vector, &hyperedge_weights, &hypernode_weights);
+      break;
+    default:
+      readHypergraphFile(filename, num_hypernodes, num_hyperedges,
+                         index_vector, edge_vector, &hyperedge_weights, &hypernode_weights);
+      break;
+  }
+  const std::shared_future<HypergraphStats> input_stats =
+    validateHypergraphAsync(num_hypernodes, num_hyperedges, index_vector, edge_vector,
+                            &hyperedge_weights, &hypernode_weights);
+  exitIfInvalid(input_stats, filename);
+  if (stats != nullptr) {
+    *stats = input_stats;
+  }
   return Hypergraph(num_hypernodes, num_hyperedges, index_vector, edge_vector,
                     num_parts, &hyperedge_weights, &hypernode_weights);
 }
 
+// ! Creates a hypergraph from a file whose format is detected automatically
+static inline Hypergraph createHypergraphFromFile(const std::string& filename,
+                                                  const PartitionID num_parts) {
+  return createHypergraphFromFile(filename, num_parts, InputFormat::automatic,
+                                  MatrixModel::row_net);
+}
+
 
 static inline void writeHypernodeWeights(std::ofstream& out_stream, const Hypergraph& hypergraph) {
   for (const HypernodeID& hn : hypergraph.nodes()) {
@@ -370,23 +792,50 @@ static inline void writeHypergraphForPaToHPartitioning(const Hypergraph& hypergr
 static inline void readPartitionFile(const std::string& filename, std::vector<PartitionID>& partition) {
   ASSERT(!filename.empty(), "No filename for partition file specified");
   ASSERT(partition.empty(), "Partition vector is not empty");
-  std::ifstream file(filename);
-  if (file) {
-    int part;
-    while (file >> part) {
-      partition.push_back(part);
-    }
-    file.close();
-  } else {
+  if (isBinaryPartitionFile(filename)) {
+    readBinaryPartitionFile(filename, partition);
+    return;
+  }
+  const bool file_found = forEachBlockOfLines(filename, [&](const char* pos, const char* end) {
+      PartitionID part = 0;
+      while (internal::scanInteger(pos, end, part)) {
+        partition.push_back(part);
+      }
+      return pos == end;
+    });
+  if (!file_found) {
     std::cerr << "Error: File not found: " << std::endl;
   }
 }
 
+/*!
+ * Writes the block ID of each enabled hypernode in its own line. The lines are formatted
+ * in parallel into chunk-local buffers, which are then written to the file in one go each.
+ */
 static inline void writePartitionFile(const Hypergraph& hypergraph, const std::string& filename) {
   if (!filename.empty()) {
-    std::ofstream out_stream(filename.c_str());
-    for (const HypernodeID& hn : hypergraph.nodes()) {
-      out_stream << hypergraph.partID(hn) << std::endl;
+    std::vector<internal::PartitionChunk> chunks(
+      utils::numThreads(hypergraph.initialNumNodes(), internal::kMinNodesPerChunk));
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      chunks[i].begin = i * hypergraph.initialNumNodes() / chunks.size();
+      chunks[i].end = (i + 1) * hypergraph.initialNumNodes() / chunks.size();
+    }
+    utils::parallelForEach(chunks, [&](internal::PartitionChunk& chunk) {
+        // at most 11 characters per block ID and newline
+        chunk.buffer.resize(12 * (chunk.end - chunk.begin));
+        char* pos = &chunk.buffer[0];
+        for (HypernodeID hn = chunk.begin; hn < chunk.end; ++hn) {
+          if (!hypergraph.nodeIsEnabled(hn)) {
+            continue;
+          }
+          pos = internal::formatInteger(hypergraph.partID(hn), pos);
+          *pos++ = '\n';
+        }
+        chunk.buffer.resize(pos - chunk.buffer.data());
+      });
+    std::ofstream out_stream(filename.c_str(), std::ios::binary);
+    for (const internal::PartitionChunk& chunk : chunks) {
+      out_stream.write(chunk.buffer.data(), chunk.buffer.size());
     }
     out_stream.close();
   }
@@ -394,18 +843,18 @@ static inline void writePartitionFile(const Hypergraph& hypergraph, const std::s
 
 static inline void readFixedVertexFile(Hypergraph& hypergraph, const std::string& filename) {
   ASSERT(!filename.empty(), "No filename for partition file specified");
-  std::ifstream file(filename);
-  if (file) {
-    PartitionID part;
-    HypernodeID hn = 0;
-    while (file >> part) {
-      if (part != -1) {
-        hypergraph.setFixedVertex(hn, part);
+  HypernodeID hn = 0;
+  const bool file_found = forEachBlockOfLines(filename, [&](const char* pos, const char* end) {
+      PartitionID part = 0;
+      while (internal::scanInteger(pos, end, part)) {
+        if (part != -1) {
+          hypergraph.setFixedVertex(hn, part);
+        }
+        hn++;
       }
-      hn++;
-    }
-    file.close();
-  } else {
+      return pos == end;
+    });
+  if (!file_found) {
     std::cerr << "Error: File not found: " << filename << std::endl;
   }
 }
@@ -0,0 +1,499 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2018 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "kahypar/definitions.h"
+#include "kahypar/utils/parallel_for.h"
+
+namespace kahypar {
+namespace io {
+// ! Distribution of hyperedge sizes/weights or hypernode degrees/weights
+struct Distribution {
+  int64_t min = 0;
+  double q1 = 0.0;
+  double med = 0.0;
+  double q3 = 0.0;
+  int64_t p90 = 0;
+  int64_t max = 0;
+  int64_t sum = 0;
+  double avg = 0.0;
+  double sd = 0.0;
+};
+
+struct HypergraphStats {
+  HypernodeID num_hypernodes = 0;
+  HyperedgeID num_hyperedges = 0;
+  size_t num_pins = 0;
+  HyperedgeID num_single_pin_hyperedges = 0;
+  Distribution he_size = { };
+  Distribution he_weight = { };
+  Distribution hn_degree = { };
+  Distribution hn_weight = { };
+  // ! Description of the first problem found in the input, empty if the input is valid
+  std::string error = { };
+
+  bool valid() const {
+    return error.empty();
+  }
+};
+
+namespace internal {
+// ! Hyperedges are only split into chunks of at least this many hyperedges for validation
+static constexpr size_t kMinHyperedgesPerChunk = static_cast<size_t>(1) << 16;
+// ! Duplicate pins of hyperedges up to this size are detected by pairwise comparison
+static constexpr size_t kMaxPairwiseDuplicateCheckSize = 8;
+
+struct ValidationChunk {
+  HyperedgeID begin = 0;
+  HyperedgeID end = 0;
+  HyperedgeID num_single_pin_hyperedges = 0;
+  int64_t total_weight = 0;
+  std::string error = { };
+};
+
+// ! Returns false if adding weight to sum would exceed the maximum representable weight
+template <typename Weight>
+static inline bool addWeight(int64_t& sum, const int64_t weight) {
+  if (weight > std::numeric_limits<Weight>::max() - sum) {
+    return false;
+  }
+  sum += weight;
+  return true;
+}
+
+/*!
+ * Computes the distribution of the values. Quantiles are determined via
+ * selection instead of sorting, which reorders the values.
+ * The quartiles are defined as in math::firstAndThirdQuartile.
+ */
+template <typename T>
+static inline Distribution createDistribution(std::vector<T>& values) {
+  Distribution distribution;
+  if (values.empty()) {
+    return distribution;
+  }
+  distribution.min = std::numeric_limits<int64_t>::max();
+  distribution.max = std::numeric_limits<int64_t>::min();
+  for (const T& value : values) {
+    distribution.min = std::min(distribution.min, static_cast<int64_t>(value));
+    distribution.max = std::max(distribution.max, static_cast<int64_t>(value));
+    distribution.sum += value;
+  }
+  const size_t n = values.size();
+  distribution.avg = static_cast<double>(distribution.sum) / n;
+  if (n > 1) {
+    double squared_deviations = 0.0;
+    for (const T& value : values) {
+      squared_deviations += (value - distribution.avg) * (value - distribution.avg);
+    }
+    distribution.sd = std::sqrt(squared_deviations / (n - 1));
+  }
+
+  const size_t m = n / 2;
+  const size_t ml = m / 2;
+  const size_t mu = m + ml;
+  const size_t p90 = static_cast<size_t>(std::ceil(0.9 * (n - 1)));
+  std::vector<size_t> ranks = { m, p90 };
+  if (m > 0) {
+    ranks.push_back(m - 1);
+  }
+  if (ml > 0) {
+    ranks.push_back(ml - 1);
+    ranks.push_back(ml);
+    ranks.push_back(mu - 1);
+    ranks.push_back(mu);
+  }
+  std::sort(ranks.begin(), ranks.end());
+  ranks.erase(std::unique(ranks.begin(), ranks.end()), ranks.end());
+  // after selecting rank r, all larger ranks are contained in [r + 1, n)
+  size_t first = 0;
+  for (const size_t rank : ranks) {
+    std::nth_element(values.begin() + first, values.begin() + rank, values.end());
+    first = rank + 1;
+  }
+
+  distribution.med = n % 2 == 0 ? static_cast<double>(values[m] + values[m - 1]) / 2.0 :
+                     static_cast<double>(values[m]);
+  if (n > 1) {
+    if (n % 4 == 0 || n % 4 == 1) {
+      distribution.q1 = (values[ml] + values[ml - 1]) / 2;
+      distribution.q3 = (values[mu] + values[mu - 1]) / 2;
+    } else {
+      distribution.q1 = values[ml];
+      distribution.q3 = values[mu];
+    }
+  }
+  distribution.p90 = values[p90];
+  return distribution;
+}
+
+// ! Per-element values from which the distributions are computed
+struct Samples {
+  std::vector<HypernodeID> he_sizes { };
+  std::vector<HyperedgeWeight> he_weights { };
+  std::vector<HyperedgeID> hn_degrees { };
+  std::vector<HypernodeWeight> hn_weights { };
+};
+
+static inline void createDistributions(HypergraphStats& stats, Samples& samples) {
+  std::vector<std::function<void()> > jobs = {
+    [&]() { stats.he_size = createDistribution(samples.he_sizes); },
+    [&]() { stats.he_weight = createDistribution(samples.he_weights); },
+    [&]() { stats.hn_degree = createDistribution(samples.hn_degrees); },
+    [&]() { stats.hn_weight = createDistribution(samples.hn_weights); }
+  };
+  utils::parallelForEach(jobs, [](const std::function<void()>& job) {
+      job();
+    });
+}
+
+// ! Returns the position of a pin contained more than once in [begin, end) or end
+static inline const HypernodeID* findDuplicatePin(const HypernodeID* begin,
+                                                  const HypernodeID* end,
+                                                  std::vector<HypernodeID>& buffer) {
+  if (static_cast<size_t>(end - begin) <= kMaxPairwiseDuplicateCheckSize) {
+    for (const HypernodeID* pin = begin; pin != end; ++pin) {
+      if (std::find(begin, pin, *pin) != pin) {
+        return pin;
+      }
+    }
+    return end;
+  }
+  buffer.assign(begin, end);
+  std::sort(buffer.begin(), buffer.end());
+  const auto duplicate = std::adjacent_find(buffer.begin(), buffer.end());
+  return duplicate == buffer.end() ? end : std::find(begin, end, *duplicate);
+}
+
+/*!
+ * Validates a hypergraph given in the index/pin representation used to construct
+ * a Hypergraph and collects the samples of its statistics in the same pass.
+ * The hyperedges are processed in parallel chunks that check the hyperedge index,
+ * the range of each pin, duplicate pins, empty hyperedges and negative weights and
+ * count the degree of each hypernode. The hypernodes are checked afterwards.
+ * If the input is invalid, stats.error describes the first problem.
+ */
+static inline HypergraphStats validate(const HypernodeID num_hypernodes,
+                                       const HyperedgeID num_hyperedges,
+                                       const size_t* index_vector,
+                                       const HypernodeID* edge_vector,
+                                       const HyperedgeWeight* hyperedge_weights,
+                                       const HypernodeWeight* hypernode_weights,
+                                       Samples& samples) {
+  HypergraphStats stats;
+  stats.num_hypernodes = num_hypernodes;
+  stats.num_hyperedges = num_hyperedges;
+  stats.num_pins = index_vector[num_hyperedges];
+  if (index_vector[0] != 0) {
+    stats.error = "Hyperedge index does not start at zero";
+    return stats;
+  }
+
+  std::vector<HypernodeID>& he_sizes = samples.he_sizes;
+  std::vector<HyperedgeWeight>& he_weights = samples.he_weights;
+  he_sizes.resize(num_hyperedges);
+  he_weights.assign(num_hyperedges, 1);
+  std::vector<std::atomic<HyperedgeID> > atomic_hn_degrees(num_hypernodes);
+
+  std::vector<ValidationChunk> chunks(
+    utils::numThreads(num_hyperedges, kMinHyperedgesPerChunk));
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    chunks[i].begin = i * num_hyperedges / chunks.size();
+    chunks[i].end = (i + 1) * num_hyperedges / chunks.size();
+  }
+  utils::parallelForEach(chunks, [&](ValidationChunk& chunk) {
+      std::vector<HypernodeID> buffer;
+      std::ostringstream error;
+      for (HyperedgeID he = chunk.begin; he < chunk.end; ++he) {
+        if (index_vector[he + 1] < index_vector[he] || index_vector[he + 1] > stats.num_pins) {
+          error << "Invalid hyperedge index for hyperedge " << he + 1;
+          break;
+        }
+        const HypernodeID* begin = edge_vector + index_vector[he];
+        const HypernodeID* end = edge_vector + index_vector[he + 1];
+        if (begin == end) {
+          error << "Hyperedge " << he + 1 << " is empty";
+          break;
+        }
+        const HypernodeID* invalid_pin = std::find_if(begin, end, [&](const HypernodeID pin) {
+            return pin >= num_hypernodes;
+          });
+        if (invalid_pin != end) {
+          error << "Hyperedge " << he + 1 << " contains hypernode " << *invalid_pin + 1
+                << ", but the hypergraph only has " << num_hypernodes << " hypernodes";
+          break;
+        }
+        const HypernodeID* duplicate_pin = findDuplicatePin(begin, end, buffer);
+        if (duplicate_pin != end) {
+          error << "Hyperedge " << he + 1 << " contains hypernode " << *duplicate_pin + 1
+                << " more than once";
+          break;
+        }
+        if (hyperedge_weights != nullptr) {
+          he_weights[he] = hyperedge_weights[he];
+          if (he_weights[he] < 0) {
+            error << "Hyperedge " << he + 1 << " has negative weight " << he_weights[he];
+            break;
+          }
+        }
+        if (!addWeight<HyperedgeWeight>(chunk.total_weight, he_weights[he])) {
+          error << "Total hyperedge weight exceeds the maximum weight of "
+                << std::numeric_limits<HyperedgeWeight>::max();
+          break;
+        }
+        he_sizes[he] = end - begin;
+        if (he_sizes[he] == 1) {
+          ++chunk.num_single_pin_hyperedges;
+        }
+        for (const HypernodeID* pin = begin; pin != end; ++pin) {
+          atomic_hn_degrees[*pin].fetch_add(1, std::memory_order_relaxed);
+        }
+      }
+      chunk.error = error.str();
+    });
+
+  int64_t total_hyperedge_weight = 0;
+  for (const ValidationChunk& chunk : chunks) {
+    if (!chunk.error.empty()) {
+      stats.error = chunk.error;
+      return stats;
+    }
+    if (!addWeight<HyperedgeWeight>(total_hyperedge_weight, chunk.total_weight)) {
+      stats.error = "Total hyperedge weight exceeds the maximum weight of " +
+                    std::to_string(std::numeric_limits<HyperedgeWeight>::max());
+      return stats;
+    }
+    stats.num_single_pin_hyperedges += chunk.num_single_pin_hyperedges;
+  }
+
+  std::vector<HyperedgeID>& hn_degrees = samples.hn_degrees;
+  std::vector<HypernodeWeight>& hn_weights = samples.hn_weights;
+  hn_degrees.resize(num_hypernodes);
+  hn_weights.assign(num_hypernodes, 1);
+  std::vector<ValidationChunk> node_chunks(
+    utils::numThreads(num_hypernodes, kMinHyperedgesPerChunk));
+  for (size_t i = 0; i < node_chunks.size(); ++i) {
+    node_chunks[i].begin = i * num_hypernodes / node_chunks.size();
+    node_chunks[i].end = (i + 1) * num_hypernodes / node_chunks.size();
+  }
+  utils::parallelForEach(node_chunks, [&](ValidationChunk& chunk) {
+      std::ostringstream error;
+      for (HypernodeID hn = chunk.begin; hn < chunk.end; ++hn) {
+        hn_degrees[hn] = atomic_hn_degrees[hn].load(std::memory_order_relaxed);
+        if (hypernode_weights != nullptr) {
+          hn_weights[hn] = hypernode_weights[hn];
+          if (hn_weights[hn] < 0) {
+            error << "Hypernode " << hn + 1 << " has negative weight " << hn_weights[hn];
+            break;
+          }
+        }
+        if (!addWeight<HypernodeWeight>(chunk.total_weight, hn_weights[hn])) {
+          error << "Total hypernode weight exceeds the maximum weight of "
+                << std::numeric_limits<HypernodeWeight>::max();
+          break;
+        }
+      }
+      chunk.error = error.str();
+    });
+
+  int64_t total_hypernode_weight = 0;
+  for (const ValidationChunk& chunk : node_chunks) {
+    if (!chunk.error.empty()) {
+      stats.error = chunk.error;
+      return stats;
+    }
+    if (!addWeight<HypernodeWeight>(total_hypernode_weight, chunk.total_weight)) {
+      stats.error = "Total hypernode weight exceeds the maximum weight of " +
+                    std::to_string(std::numeric_limits<HypernodeWeight>::max());
+      return stats;
+    }
+  }
+
+  return stats;
+}
+
+static inline std::string checkIndex(const HyperedgeID num_hyperedges,
+                                     const HyperedgeIndexVector& index_vector,
+                                     const HyperedgeVector& edge_vector) {
+  if (index_vector.size() != num_hyperedges + 1 || index_vector.back() != edge_vector.size()) {
+    return "Hyperedge index does not match the number of hyperedges and pins";
+  }
+  return "";
+}
+
+template <typename Vector>
+static inline const typename Vector::value_type* dataOrNull(const Vector* vector) {
+  return vector == nullptr || vector->empty() ? nullptr : vector->data();
+}
+}  // namespace internal
+
+/*!
+ * Validates a hypergraph given in the index/pin representation used to construct
+ * a Hypergraph and computes its statistics in the same pass.
+ * If the input is invalid, stats.error describes the first problem and no
+ * distributions are computed.
+ *
+ * \param hyperedge_weights may be nullptr for unit weights
+ * \param hypernode_weights may be nullptr for unit weights
+ */
+static inline HypergraphStats validateHypergraph(const HypernodeID num_hypernodes,
+                                                 const HyperedgeID num_hyperedges,
+                                                 const size_t* index_vector,
+                                                 const HypernodeID* edge_vector,
+                                                 const HyperedgeWeight* hyperedge_weights = nullptr,
+                                                 const HypernodeWeight* hypernode_weights = nullptr) {
+  internal::Samples samples;
+  HypergraphStats stats = internal::validate(num_hypernodes, num_hyperedges, index_vector,
+                                             edge_vector, hyperedge_weights, hypernode_weights,
+                                             samples);
+  if (stats.valid()) {
+    internal::createDistributions(stats, samples);
+  }
+  return stats;
+}
+
+/*!
+ * Validates the hypergraph like validateHypergraph, but only waits for the
+ * validation. The distributions, which are only needed once partitioning starts,
+ * are computed in a background thread while the caller constructs the hypergraph.
+ * If the input is invalid, the returned statistics are available immediately.
+ */
+static inline std::shared_future<HypergraphStats> validateHypergraphAsync(
+  const HypernodeID num_hypernodes,
+  const HyperedgeID num_hyperedges,
+  const size_t* index_vector,
+  const HypernodeID* edge_vector,
+  const HyperedgeWeight* hyperedge_weights = nullptr,
+  const HypernodeWeight* hypernode_weights = nullptr) {
+  std::unique_ptr<internal::Samples> samples(new internal::Samples());
+  HypergraphStats stats = internal::validate(num_hypernodes, num_hyperedges, index_vector,
+                                             edge_vector, hyperedge_weights, hypernode_weights,
+                                             *samples);
+  if (!stats.valid()) {
+    std::promise<HypergraphStats> invalid;
+    invalid.set_value(stats);
+    return invalid.get_future().share();
+  }
+  return std::async(std::launch::async, [stats, samples = std::move(samples)]() mutable {
+      internal::createDistributions(stats, *samples);
+      return stats;
+    }).share();
+}
+
+static inline HypergraphStats validateHypergraph(const HypernodeID num_hypernodes,
+                                                 const HyperedgeID num_hyperedges,
+                                                 const HyperedgeIndexVector& index_vector,
+                                                 const HyperedgeVector& edge_vector,
+                                                 const HyperedgeWeightVector* hyperedge_weights = nullptr,
+                                                 const HypernodeWeightVector* hypernode_weights = nullptr) {
+  HypergraphStats stats;
+  stats.error = internal::checkIndex(num_hyperedges, index_vector, edge_vector);
+  if (!stats.valid()) {
+    return stats;
+  }
+  return validateHypergraph(num_hypernodes, num_hyperedges, index_vector.data(), edge_vector.data(),
+                            internal::dataOrNull(hyperedge_weights),
+                            internal::dataOrNull(hypernode_weights));
+}
+
+static inline std::shared_future<HypergraphStats> validateHypergraphAsync(
+  const HypernodeID num_hypernodes,
+  const HyperedgeID num_hyperedges,
+  const HyperedgeIndexVector& index_vector,
+  const HyperedgeVector& edge_vector,
+  const HyperedgeWeightVector* hyperedge_weights = nullptr,
+  const HypernodeWeightVector* hypernode_weights = nullptr) {
+  HypergraphStats stats;
+  stats.error = internal::checkIndex(num_hyperedges, index_vector, edge_vector);
+  if (!stats.valid()) {
+    std::promise<HypergraphStats> invalid;
+    invalid.set_value(stats);
+    return invalid.get_future().share();
+  }
+  return validateHypergraphAsync(num_hypernodes, num_hyperedges, index_vector.data(),
+                                 edge_vector.data(), internal::dataOrNull(hyperedge_weights),
+                                 internal::dataOrNull(hypernode_weights));
+}
+
+// ! Terminates with an error message if the hypergraph read from filename is invalid
+static inline void exitIfInvalid(const HypergraphStats& stats, const std::string& filename) {
+  if (!stats.valid()) {
+    std::cerr << "Error: Invalid hypergraph " << filename << ": " << stats.error << std::endl;
+    exit(1);
+  }
+}
+
+// ! Does not wait for the distributions, since invalid statistics are always ready
+static inline void exitIfInvalid(const std::shared_future<HypergraphStats>& stats,
+                                 const std::string& filename) {
+  if (stats.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+    exitIfInvalid(stats.get(), filename);
+  }
+}
+
+// ! Computes the statistics of all enabled hypernodes and hyperedges of the hypergraph
+static inline HypergraphStats computeHypergraphStats(const Hypergraph& hypergraph) {
+  HypergraphStats stats;
+  stats.num_hypernodes = hypergraph.currentNumNodes();
+  stats.num_hyperedges = hypergraph.currentNumEdges();
+  stats.num_pins = hypergraph.currentNumPins();
+
+  internal::Samples samples;
+  std::vector<HypernodeID>& he_sizes = samples.he_sizes;
+  std::vector<HyperedgeWeight>& he_weights = samples.he_weights;
+  std::vector<HyperedgeID>& hn_degrees = samples.hn_degrees;
+  std::vector<HypernodeWeight>& hn_weights = samples.hn_weights;
+  he_sizes.reserve(hypergraph.currentNumEdges());
+  he_weights.reserve(hypergraph.currentNumEdges());
+  hn_degrees.reserve(hypergraph.currentNumNodes());
+  hn_weights.reserve(hypergraph.currentNumNodes());
+  for (const HyperedgeID& he : hypergraph.edges()) {
+    he_sizes.push_back(hypergraph.edgeSize(he));
+    he_weights.push_back(hypergraph.edgeWeight(he));
+    if (hypergraph.edgeSize(he) == 1) {
+      ++stats.num_single_pin_hyperedges;
+    }
+  }
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    hn_degrees.push_back(hypergraph.nodeDegree(hn));
+    hn_weights.push_back(hypergraph.nodeWeight(hn));
+  }
+
+  internal::createDistributions(stats, samples);
+  return stats;
+}
+}  // namespace io
+}  // namespace kahypar
@@ -0,0 +1,103 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace kahypar {
+namespace io {
+namespace internal {
+static inline const char* endOfLine(const char* pos, const char* end) {
+  if (pos == end) {
+    return end;
+  }
+  const void* eol = memchr(pos, '\n', end - pos);
+  return eol == nullptr ? end : static_cast<const char*>(eol);
+}
+
+static inline const char* nextLine(const char* pos, const char* end) {
+  const char* eol = endOfLine(pos, end);
+  return eol == end ? end : eol + 1;
+}
+
+static inline bool isCommentLine(const char* pos, const char* end) {
+  return pos != end && *pos == '%';
+}
+
+static inline const char* skipWhitespace(const char* pos, const char* end) {
+  while (pos != end && (*pos == ' ' || *pos == '\t' || *pos == '\r' || *pos == '\n')) {
+    ++pos;
+  }
+  return pos;
+}
+
+// ! Parses the next integer in [pos, end) and returns false if there is none or if it
+// ! does not fit into T. In the latter case, pos is left at the start of the integer.
+template <typename T>
+static inline bool scanInteger(const char*& pos, const char* end, T& value) {
+  pos = skipWhitespace(pos, end);
+  const bool negative = std::is_signed<T>::value && pos != end && *pos == '-';
+  const char* digits = negative ? pos + 1 : pos;
+  if (digits == end || *digits < '0' || *digits > '9') {
+    return false;
+  }
+  const char* number = pos;
+  pos = digits;
+  T result = 0;
+  do {
+    const T digit = static_cast<T>(*pos - '0');
+    if (result > (std::numeric_limits<T>::max() - digit) / 10) {
+      pos = number;
+      return false;
+    }
+    result = 10 * result + digit;
+    ++pos;
+  } while (pos != end && *pos >= '0' && *pos <= '9');
+  value = negative ? static_cast<T>(0 - result) : result;
+  return true;
+}
+
+/*!
+ * Splits [begin, end) into chunks of roughly equal size, each starting at the
+ * beginning of a line. Chunk has to provide begin and end members.
+ */
+template <typename Chunk>
+static inline void splitAtLines(const char* begin, const char* end, std::vector<Chunk>& chunks) {
+  const size_t chunk_size = static_cast<size_t>(end - begin) / chunks.size();
+  const char* chunk_begin = begin;
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    chunks[i].begin = chunk_begin;
+    if (i + 1 < chunks.size()) {
+      const char* split = std::max(chunk_begin, begin + (i + 1) * chunk_size);
+      chunk_begin = split == chunk_begin ? chunk_begin : nextLine(split - 1, end);
+    } else {
+      chunk_begin = end;
+    }
+    chunks[i].end = chunk_begin;
+  }
+}
+}  // namespace internal
+}  // namespace io
+}  // namespace kahypar
@@ -0,0 +1,264 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "kahypar/definitions.h"
+#include "kahypar/io/compressed_file.h"
+#include "kahypar/io/line_parsing.h"
+#include "kahypar/partition/context_enum_classes.h"
+#include "kahypar/utils/parallel_for.h"
+
+namespace kahypar {
+namespace io {
+namespace internal {
+// ! Files are only split into chunks of at least this size for parallel parsing
+static constexpr size_t kMinBytesPerMtxChunk = static_cast<size_t>(1) << 20;
+
+struct MtxHeader {
+  bool weighted = false;
+  bool symmetric = false;
+  uint64_t num_rows = 0;
+  uint64_t num_columns = 0;
+  uint64_t num_entries = 0;
+};
+
+struct MtxChunk {
+  const char* begin = nullptr;
+  const char* end = nullptr;
+  // global index of the first entry line of the chunk
+  size_t first_line = 0;
+  size_t num_lines = 0;
+  // (row, column) of each nonzero starting at 0, including mirrored entries of symmetric matrices
+  std::vector<std::pair<HypernodeID, HypernodeID> > nonzeros = { };
+  size_t invalid_line = std::numeric_limits<size_t>::max();
+};
+
+static inline bool isBlankLine(const char* pos, const char* end) {
+  return skipWhitespace(pos, end) == end;
+}
+
+// ! Returns the position of the first entry line
+static inline const char* parseMtxHeader(const char* pos, const char* end, MtxHeader& header) {
+  const char* eol = endOfLine(pos, end);
+  std::string line(pos, eol);
+  std::transform(line.begin(), line.end(), line.begin(), [](const unsigned char c) {
+      return static_cast<char>(std::tolower(c));
+    });
+  std::istringstream sstream(line);
+  std::string matrix_market, object, matrix_format, data_format, symmetry;
+  sstream >> matrix_market >> object >> matrix_format >> data_format >> symmetry;
+  if (matrix_market != "%%matrixmarket" || matrix_format != "coordinate" ||
+      (object != "matrix" && object != "weightedmatrix")) {
+    std::cerr << "Error: Only MatrixMarket files in coordinate format are supported" << std::endl;
+    exit(1);
+  }
+  header.weighted = object == "weightedmatrix";
+  // skew-symmetric and hermitian matrices have the same nonzero pattern as symmetric ones
+  header.symmetric = symmetry != "general";
+
+  pos = nextLine(pos, end);
+  while (pos != end && (isCommentLine(pos, end) || isBlankLine(pos, endOfLine(pos, end)))) {
+    pos = nextLine(pos, end);
+  }
+  eol = endOfLine(pos, end);
+  if (!scanInteger(pos, eol, header.num_rows) || !scanInteger(pos, eol, header.num_columns) ||
+      !scanInteger(pos, eol, header.num_entries)) {
+    std::cerr << "Error: MatrixMarket file does not specify its dimensions" << std::endl;
+    exit(1);
+  }
+  return nextLine(eol, end);
+}
+}  // namespace internal
+
+/*!
+ * Reads a sparse matrix in MatrixMarket coordinate format as hypergraph:
+ *   - row-net model:    each row is a hyperedge containing the columns of its nonzeros
+ *   - column-net model: each column is a hyperedge containing the rows of its nonzeros
+ *   - fine-grain model: each nonzero is a hypernode contained in the hyperedges
+ *                       of its row and its column
+ * Symmetric matrices are expanded to both triangles. Empty hyperedges are
+ * removed. The column weights of weighted matrices (Mondriaan format) are
+ * used as hypernode weights in the row-net model. Entry lines are parsed in
+ * parallel, afterwards the nonzeros are grouped by hyperedge via counting sort,
+ * which preserves their order in the file.
+ */
+static inline void readMatrixMarketFile(const std::string& filename, const MatrixModel model,
+                                        HypernodeID& num_hypernodes,
+                                        HyperedgeID& num_hyperedges,
+                                        HyperedgeIndexVector& index_vector,
+                                        HyperedgeVector& edge_vector,
+                                        HypernodeWeightVector* hypernode_weights) {
+  ASSERT(index_vector.empty() && edge_vector.empty());
+  const bool file_found = withFileContents(filename, [&](const char* begin, const char* end) {
+      internal::MtxHeader header;
+      const char* body = internal::parseMtxHeader(begin, end, header);
+
+      std::vector<internal::MtxChunk> chunks(
+        utils::numThreads(end - body, internal::kMinBytesPerMtxChunk));
+      internal::splitAtLines(body, end, chunks);
+      utils::parallelForEach(chunks, [](internal::MtxChunk& chunk) {
+          for (const char* line = chunk.begin; line != chunk.end;
+               line = internal::nextLine(line, chunk.end)) {
+            const char* eol = internal::endOfLine(line, chunk.end);
+            if (!internal::isCommentLine(line, eol) && !internal::isBlankLine(line, eol)) {
+              ++chunk.num_lines;
+            }
+          }
+        });
+      size_t num_lines = 0;
+      for (internal::MtxChunk& chunk : chunks) {
+        chunk.first_line = num_lines;
+        num_lines += chunk.num_lines;
+      }
+      if (num_lines < header.num_entries) {
+        std::cerr << "Error: MatrixMarket file contains " << num_lines << " instead of "
+                  << header.num_entries << " entries" << std::endl;
+        exit(1);
+      }
+
+      HypernodeWeightVector column_weights;
+      if (header.weighted) {
+        column_weights.resize(header.num_columns, 1);
+      }
+      utils::parallelForEach(chunks, [&](internal::MtxChunk& chunk) {
+          size_t line_index = chunk.first_line;
+          for (const char* line = chunk.begin; line != chunk.end;
+               line = internal::nextLine(line, chunk.end)) {
+            const char* eol = internal::endOfLine(line, chunk.end);
+            if (internal::isCommentLine(line, eol) || internal::isBlankLine(line, eol)) {
+              continue;
+            }
+            const char* pos = line;
+            if (line_index < header.num_entries) {
+              uint64_t row = 0;
+              uint64_t column = 0;
+              if (!internal::scanInteger(pos, eol, row) ||
+                  !internal::scanInteger(pos, eol, column) ||
+                  row == 0 || row > header.num_rows || column == 0 || column > header.num_columns) {
+                chunk.invalid_line = line_index;
+                return;
+              }
+              // indices start at 1
+              chunk.nonzeros.emplace_back(row - 1, column - 1);
+              if (header.symmetric && row != column) {
+                chunk.nonzeros.emplace_back(column - 1, row - 1);
+              }
+            } else if (line_index - header.num_entries < column_weights.size()) {
+              internal::scanInteger(pos, eol, column_weights[line_index - header.num_entries]);
+            }
+            ++line_index;
+          }
+        });
+      for (const internal::MtxChunk& chunk : chunks) {
+        if (chunk.invalid_line != std::numeric_limits<size_t>::max()) {
+          std::cerr << "Error: Entry " << chunk.invalid_line << " of MatrixMarket file is invalid"
+                    << std::endl;
+          exit(1);
+        }
+      }
+
+      size_t num_nonzeros = 0;
+      for (const internal::MtxChunk& chunk : chunks) {
+        num_nonzeros += chunk.nonzeros.size();
+      }
+      size_t num_nets = 0;
+      switch (model) {
+        case MatrixModel::row_net:
+          num_nets = header.num_rows;
+          num_hypernodes = header.num_columns;
+          break;
+        case MatrixModel::column_net:
+          num_nets = header.num_columns;
+          num_hypernodes = header.num_rows;
+          break;
+        case MatrixModel::fine_grain:
+          num_nets = header.num_rows + header.num_columns;
+          num_hypernodes = num_nonzeros;
+          break;
+      }
+      const auto for_each_pin = [&](const auto& f) {
+                                  size_t nonzero = 0;
+                                  for (const internal::MtxChunk& chunk : chunks) {
+                                    for (const auto& entry : chunk.nonzeros) {
+                                      switch (model) {
+                                        case MatrixModel::row_net:
+                                          f(entry.first, entry.second);
+                                          break;
+                                        case MatrixModel::column_net:
+                                          f(entry.second, entry.first);
+                                          break;
+                                        case MatrixModel::fine_grain:
+                                          f(entry.first, nonzero);
+                                          f(header.num_rows + entry.second, nonzero);
+                                          break;
+                                      }
+                                      ++nonzero;
+                                    }
+                                  }
+                                };
+
+      // counting sort of the pins by their (non-empty) net
+      std::vector<size_t> net_size(num_nets, 0);
+      for_each_pin([&](const size_t net, const size_t) {
+          ++net_size[net];
+        });
+      std::vector<HyperedgeID> net_id(num_nets);
+      num_hyperedges = 0;
+      index_vector.push_back(0);
+      for (size_t net = 0; net < num_nets; ++net) {
+        net_id[net] = num_hyperedges;
+        if (net_size[net] > 0) {
+          ++num_hyperedges;
+          index_vector.push_back(index_vector.back() + net_size[net]);
+        }
+      }
+      edge_vector.resize(index_vector.back());
+      std::vector<size_t> next_pin(index_vector.begin(), index_vector.end() - 1);
+      for_each_pin([&](const size_t net, const size_t pin) {
+          edge_vector[next_pin[net_id[net]]++] = pin;
+        });
+
+      if (header.weighted) {
+        if (model == MatrixModel::row_net && hypernode_weights != nullptr) {
+          *hypernode_weights = std::move(column_weights);
+        } else {
+          LOG << " ****** ignoring hypernode weights ******";
+        }
+      }
+    });
+  if (!file_found) {
+    std::cerr << "Error: File not found: " << filename << std::endl;
+    exit(1);
+  }
+}
+}  // namespace io
+}  // namespace kahypar
@@ -0,0 +1,151 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2018 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#if defined(_MSC_VER)
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "kahypar/macros.h"
+
+namespace kahypar {
+namespace io {
+/*!
+ * Read-only view on the contents of a file. On POSIX systems, regular files
+ * are mapped into memory. Otherwise (e.g., for pipes), the file is read into
+ * a buffer.
+ */
+class MemoryMappedFile {
+ public:
+  explicit MemoryMappedFile(const std::string& filename) :
+    _buffer(),
+    _data(nullptr),
+    _size(0),
+    _is_mapped(false),
+    _is_open(false) {
+#if defined(_MSC_VER)
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if (file) {
+      _buffer.resize(static_cast<size_t>(file.tellg()));
+      file.seekg(0);
+      file.read(_buffer.data(), _buffer.size());
+      _data = _buffer.data();
+      _size = _buffer.size();
+      _is_open = true;
+    }
+#else
+    const int fd = open(filename.c_str(), O_RDONLY);
+    if (fd == -1) {
+      return;
+    }
+    struct stat file_info;
+    if (fstat(fd, &file_info) == 0) {
+      if (S_ISREG(file_info.st_mode)) {
+        _size = static_cast<size_t>(file_info.st_size);
+        if (_size == 0) {
+          _is_open = true;
+        } else {
+          void* data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+          if (data != MAP_FAILED) {
+            // read the whole file ahead in the background while the first pages are parsed
+            madvise(data, _size, MADV_SEQUENTIAL);
+            madvise(data, _size, MADV_WILLNEED);
+            _data = static_cast<const char*>(data);
+            _is_mapped = true;
+            _is_open = true;
+          } else {
+            _size = 0;
+          }
+        }
+      } else {
+        char chunk[1 << 16];
+        ssize_t bytes_read = 0;
+        while ((bytes_read = read(fd, chunk, sizeof(chunk))) > 0) {
+          _buffer.insert(_buffer.end(), chunk, chunk + bytes_read);
+        }
+        _data = _buffer.data();
+        _size = _buffer.size();
+        _is_open = bytes_read == 0;
+      }
+    }
+    close(fd);
+#endif
+  }
+
+  MemoryMappedFile(const MemoryMappedFile&) = delete;
+  MemoryMappedFile& operator= (const MemoryMappedFile&) = delete;
+
+  MemoryMappedFile(MemoryMappedFile&&) = delete;
+  MemoryMappedFile& operator= (MemoryMappedFile&&) = delete;
+
+  ~MemoryMappedFile() {
+#if !defined(_MSC_VER)
+    if (_is_mapped) {
+      munmap(const_cast<char*>(_data), _size);
+    }
+#endif
+  }
+
+  // ! Returns false for files that can only be read once, e.g., pipes
+  static bool isRegularFile(const std::string& filename) {
+#if defined(_MSC_VER)
+    unused(filename);
+    return true;
+#else
+    struct stat file_info;
+    return stat(filename.c_str(), &file_info) == 0 && S_ISREG(file_info.st_mode);
+#endif
+  }
+
+  bool isOpen() const {
+    return _is_open;
+  }
+
+  const char* begin() const {
+    return _data;
+  }
+
+  const char* end() const {
+    return _data + _size;
+  }
+
+  size_t size() const {
+    return _size;
+  }
+
+ private:
+  std::vector<char> _buffer;
+  const char* _data;
+  size_t _size;
+  bool _is_mapped;
+  bool _is_open;
+};
+}  // namespace io
+}  // namespace kahypar
@@ -30,9 +30,11 @@
 
 #include "kahypar/definitions.h"
 #include "kahypar/git_revision.h"
+#include "kahypar/io/hypergraph_statistics.h"
 #include "kahypar/partition/context.h"
 #include "kahypar/partition/metrics.h"
 #include "kahypar/utils/math.h"
+#include "kahypar/utils/memory_tracker.h"
 #include "kahypar/utils/timer.h"
 
 namespace kahypar {
@@ -48,19 +50,15 @@ struct Statistic {
   double sd = 0.0;
 };
 
-template <typename T>
-Statistic createStats(const std::vector<T>& vec, const double avg, const double stdev) {
+static inline Statistic createStats(const Distribution& distribution) {
   internal::Statistic stats;
-  if (!vec.empty()) {
-    const auto quartiles = math::firstAndThirdQuartile(vec);
-    stats.min = vec.front();
-    stats.q1 = quartiles.first;
-    stats.med = math::median(vec);
-    stats.q3 = quartiles.second;
-    stats.max = vec.back();
-    stats.avg = avg;
-    stats.sd = stdev;
-  }
+  stats.min = distribution.min;
+  stats.q1 = distribution.q1;
+  stats.med = distribution.med;
+  stats.q3 = distribution.q3;
+  stats.max = distribution.max;
+  stats.avg = distribution.avg;
+  stats.sd = distribution.sd;
   return stats;
 }
 
@@ -111,70 +109,23 @@ void printStats(const Statistic& he_size_stats,
 }
 }  // namespace internal
 
-inline void printHypergraphInfo(const Hypergraph& hypergraph, const std::string& name) {
-  std::vector<HypernodeID> he_sizes;
-  std::vector<HyperedgeWeight> he_weights;
-  std::vector<HyperedgeID> hn_degrees;
-  std::vector<HypernodeWeight> hn_weights;
-  he_sizes.reserve(hypergraph.currentNumEdges());
-  he_weights.reserve(hypergraph.currentNumEdges());
-  hn_degrees.reserve(hypergraph.currentNumNodes());
-  hn_weights.reserve(hypergraph.currentNumNodes());
-
-  const double avg_hn_degree = metrics::avgHypernodeDegree(hypergraph);
-  double stdev_hn_degree = 0.0;
-  for (const auto& hn : hypergraph.nodes()) {
-    hn_degrees.push_back(hypergraph.nodeDegree(hn));
-    hn_weights.push_back(hypergraph.nodeWeight(hn));
-    stdev_hn_degree += (hypergraph.nodeDegree(hn) - avg_hn_degree) *
-                       (hypergraph.nodeDegree(hn) - avg_hn_degree);
-  }
-  stdev_hn_degree = std::sqrt(stdev_hn_degree / (hypergraph.currentNumNodes() - 1));
-
-
-  const double avg_he_size = metrics::avgHyperedgeDegree(hypergraph);
-  double stdev_he_size = 0.0;
-  for (const auto& he : hypergraph.edges()) {
-    he_sizes.push_back(hypergraph.edgeSize(he));
-    he_weights.push_back(hypergraph.edgeWeight(he));
-    stdev_he_size += (hypergraph.edgeSize(he) - avg_he_size) *
-                     (hypergraph.edgeSize(he) - avg_he_size);
-  }
-  stdev_he_size = std::sqrt(stdev_he_size / (hypergraph.currentNumEdges() - 1));
-
-  std::sort(he_sizes.begin(), he_sizes.end());
-  std::sort(he_weights.begin(), he_weights.end());
-  std::sort(hn_degrees.begin(), hn_degrees.end());
-  std::sort(hn_weights.begin(), hn_weights.end());
-
-  const double avg_hn_weight = std::accumulate(hn_weights.begin(), hn_weights.end(), 0.0) /
-                               static_cast<double>(hn_weights.size());
-  const double avg_he_weight = std::accumulate(he_weights.begin(), he_weights.end(), 0.0) /
-                               static_cast<double>(he_weights.size());
-
-  double stdev_hn_weight = 0.0;
-  for (const HypernodeWeight& hn_weight : hn_weights) {
-    stdev_hn_weight += (hn_weight - avg_hn_weight) * (hn_weight - avg_hn_weight);
-  }
-  stdev_hn_weight = std::sqrt(stdev_hn_weight / (hypergraph.currentNumNodes() - 1));
-
-  double stdev_he_weight = 0.0;
-  for (const HyperedgeWeight& he_weight : he_weights) {
-    stdev_he_weight += (he_weight - avg_he_weight) * (he_weight - avg_he_weight);
-  }
-  stdev_he_weight = std::sqrt(stdev_he_weight / (hypergraph.currentNumNodes() - 1));
-
+inline void printHypergraphInfo(const Hypergraph& hypergraph, const HypergraphStats& stats,
+                                const std::string& name) {
   LOG << "Hypergraph Information";
   LOG << "Name :" << name;
   LOG << "Type:" << hypergraph.typeAsString();
-  LOG << "# HNs :" << hypergraph.currentNumNodes()
-      << "# HEs :" << hypergraph.currentNumEdges()
-      << "# pins:" << hypergraph.currentNumPins();
-
-  internal::printStats(internal::createStats(he_sizes, avg_he_size, stdev_he_size),
-                       internal::createStats(he_weights, avg_he_weight, stdev_he_weight),
-                       internal::createStats(hn_degrees, avg_hn_degree, stdev_hn_degree),
-                       internal::createStats(hn_weights, avg_hn_weight, stdev_hn_weight));
+  LOG << "# HNs :" << stats.num_hypernodes
+      << "# HEs :" << stats.num_hyperedges
+      << "# pins:" << stats.num_pins;
+
+  internal::printStats(internal::createStats(stats.he_size),
+                       internal::createStats(stats.he_weight),
+                       internal::createStats(stats.hn_degree),
+                       internal::createStats(stats.hn_weight));
+}
+
+inline void printHypergraphInfo(const Hypergraph& hypergraph, const std::string& name) {
+  printHypergraphInfo(hypergraph, computeHypergraphStats(hypergraph), name);
 }
 
 inline void printPartSizesAndWeights(const Hypergraph& hypergraph) {
@@ -216,6 +167,36 @@ inline void printQualityOfInitialSolution(const Hypergraph& hypergraph, const Co
   }
 }
 
+inline void printMemoryConsumption(const Context& context) {
+  const MemoryTracker& memory = MemoryTracker::instance();
+  if (memory.maxSample() == 0) {
+    return;
+  }
+  const std::vector<std::pair<std::string, Timepoint> > phases = {
+    { "  + Coarsening                     =", Timepoint::coarsening },
+    { "  + Initial Partitioning           =", Timepoint::initial_partitioning },
+    { "    + Coarsening                   =", Timepoint::ip_coarsening },
+    { "    + Initial Partitioning         =", Timepoint::ip_initial_partitioning },
+    { "    + Local Search                 =", Timepoint::ip_local_search },
+    { "  + Local Search                   =", Timepoint::local_search },
+    { "  + V-Cycle Coarsening             =", Timepoint::v_cycle_coarsening },
+    { "  + V-Cycle Local Search           =", Timepoint::v_cycle_local_search },
+    { "  + Evolutionary                   =", Timepoint::evolutionary }
+  };
+
+  LOG << "\nMemory (max sampled phase footprint):";
+  LOG << "Max sampled phase footprint        =" << MemoryTreeNode::toMegaBytes(memory.maxSample()) << "MB";
+  for (const auto& phase : phases) {
+    if (memory.maxSample(phase.second) > 0) {
+      LOG << phase.first << MemoryTreeNode::toMegaBytes(memory.maxSample(phase.second)) << "MB";
+    }
+  }
+  if (context.partition.verbose_output && memory.maxSampleTree() != nullptr) {
+    LOG << "\nMemory tree of max sampled phase footprint:";
+    LLOG << *memory.maxSampleTree();
+  }
+}
+
 inline void printPartitioningResults(const Hypergraph& hypergraph,
                                      const Context& context,
                                      const std::chrono::duration<double>& elapsed_seconds) {
@@ -231,6 +212,9 @@ inline void printPartitioningResults(const Hypergraph& hypergraph,
     const auto& timings = Timer::instance().result();
 
     LOG << "\nTimings:";
+    if (timings.read_hypergraph > 0.0) {
+      LOG << "Read hypergraph time               =" << timings.read_hypergraph << "s";
+    }
     LOG << "Partition time                     =" << elapsed_seconds.count() << "s";
     if (!context.partition_evolutionary && !context.partition.time_limited_repeated_partitioning) {
       LOG << "  + Preprocessing                  =" << timings.total_preprocessing << "s";
@@ -295,6 +279,7 @@ inline void printPartitioningResults(const Hypergraph& hypergraph,
       LOG << "  + Postprocessing                 =" << timings.total_postprocessing << "s";
       LOG << "    | undo sparsifier              =" << timings.post_sparsifier_restore << "s";
     }
+    printMemoryConsumption(context);
     LOG << "";
   }
 }
@@ -321,14 +306,15 @@ static inline void printBanner(const Context& context) {
 }
 
 
-static inline void printInputInformation(const Context& context, const Hypergraph& hypergraph) {
+static inline void printInputInformation(const Context& context, const Hypergraph& hypergraph,
+                                         const HypergraphStats& stats) {
   if (context.type == ContextType::main && !context.partition.quiet_mode) {
     LOG << context;
     if (context.partition.verbose_output) {
       LOG << "\n********************************************************************************";
       LOG << "*                                    Input                                     *";
       LOG << "********************************************************************************";
-      io::printHypergraphInfo(hypergraph, context.partition.graph_filename.substr(
+      io::printHypergraphInfo(hypergraph, stats, context.partition.graph_filename.substr(
                                 context.partition.graph_filename.find_last_of('/') + 1));
     }
   }
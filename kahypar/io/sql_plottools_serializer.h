@@ -31,6 +31,7 @@
 #include "kahypar/partition/evolutionary/individual.h"
 #include "kahypar/partition/metrics.h"
 #include "kahypar/partition/partitioner.h"
+#include "kahypar/utils/memory_tracker.h"
 
 namespace kahypar {
 namespace io {
@@ -229,6 +230,21 @@ static inline void serialize(const Context& context, const Hypergraph& hypergrap
         << " postMinHashSparsifierTime=" << timings.post_sparsifier_restore;
   }
 
+  oss << " readHypergraphTime=" << timings.read_hypergraph;
+
+  const MemoryTracker& memory = MemoryTracker::instance();
+  oss << " maxSampledPhaseFootprint=" << memory.maxSample()
+      << " maxSampledPhaseFootprintCoarsening=" << memory.maxSample(Timepoint::coarsening)
+      << " maxSampledPhaseFootprintInitialPartitioning="
+      << memory.maxSample(Timepoint::initial_partitioning)
+      << " maxSampledPhaseFootprintUncoarseningRefinement="
+      << memory.maxSample(Timepoint::local_search)
+      << " maxSampledPhaseFootprintVCycleCoarsening="
+      << memory.maxSample(Timepoint::v_cycle_coarsening)
+      << " maxSampledPhaseFootprintVCycleRefinement="
+      << memory.maxSample(Timepoint::v_cycle_local_search)
+      << " maxSampledPhaseFootprintEvolutionary=" << memory.maxSample(Timepoint::evolutionary);
+
   if (context.partition.global_search_iterations > 0) {
     int i = 1;
     for (const auto& timing : timings.v_cycle_coarsening) {
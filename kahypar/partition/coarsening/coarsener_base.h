@@ -32,9 +32,11 @@
 #include "kahypar/meta/mandatory.h"
 #include "kahypar/partition/coarsening/coarsening_memento.h"
 #include "kahypar/partition/coarsening/hypergraph_pruner.h"
+#include "kahypar/partition/coarsening/i_coarsener.h"
 #include "kahypar/partition/context.h"
 #include "kahypar/partition/metrics.h"
 #include "kahypar/partition/refinement/i_refiner.h"
+#include "kahypar/utils/memory_tree.h"
 #include "kahypar/utils/progress_bar.h"
 
 namespace kahypar {
@@ -74,14 +76,87 @@ class CoarsenerBase {
 
  protected:
   void performContraction(const HypernodeID rep_node, const HypernodeID contracted_node) {
-    _history.emplace_back(_hg.contract(rep_node, contracted_node));
+    performClusterContraction(rep_node, contracted_node);
+    removeParallelHyperedges();
+  }
+
+  /*!
+   * Contracts a node into the representative of a cluster without removing parallel
+   * hyperedges. Since these are found via the incident hyperedges of the representative,
+   * it suffices to call removeParallelHyperedges() once after the last contraction of
+   * the cluster. During uncoarsening, they are then restored before the last contraction
+   * is undone, which recreates the state in which the other contractions of the cluster
+   * were performed.
+   */
+  void performClusterContraction(const HypernodeID rep_node, const HypernodeID contracted_node) {
+    const Hypergraph::ContractionMemento memento = _hg.contract(rep_node, contracted_node);
+    addContraction(memento, _hg.currentNumNodes());
+  }
+
+  /*!
+   * Adds a contraction that was already performed on the hypergraph (e.g., concurrently)
+   * to the history and removes the single-node hyperedges it created. num_nodes is the
+   * number of hypernodes directly after the contraction.
+   */
+  void addContraction(const Hypergraph::ContractionMemento& memento, const HypernodeID num_nodes) {
+    _history.emplace_back(memento);
     _coarsening_progress_bar += 1;
-    if (_hg.nodeWeight(rep_node) > _max_hn_weights.back().max_weight) {
-      _max_hn_weights.emplace_back(CurrentMaxNodeWeight { _hg.currentNumNodes(),
-                                                          _hg.nodeWeight(rep_node) });
+    if (_hg.nodeWeight(memento.u) > _max_hn_weights.back().max_weight) {
+      _max_hn_weights.emplace_back(CurrentMaxNodeWeight { num_nodes, _hg.nodeWeight(memento.u) });
     }
     removeSingleNodeHyperedges();
-    removeParallelHyperedges();
+  }
+
+  /*!
+   * Performs the contractions of the sequence in order. Replaying stops at the limit
+   * and before the first contraction that is not possible in the current hypergraph
+   * or would exceed the maximum allowed node weight. Since the pruner is applied after
+   * each contraction, the resulting hierarchy is the same as if the contractions had
+   * been found by the coarsener.
+   *
+   * \return true if the limit was reached
+   */
+  bool replayContractions(const ContractionSequence& contractions, const HypernodeID limit,
+                          size_t& num_replayed) {
+    num_replayed = 0;
+    for (const auto& contraction : contractions) {
+      if (_hg.currentNumFreeVertices() <= limit) {
+        break;
+      }
+      const HypernodeID rep_node = contraction.first;
+      const HypernodeID contracted_node = contraction.second;
+      if (!isReplayableContraction(rep_node, contracted_node)) {
+        break;
+      }
+      performContraction(rep_node, contracted_node);
+      ++num_replayed;
+    }
+    if (_hg.currentNumFreeVertices() <= limit) {
+      finalizeProgressBar();
+      return true;
+    }
+    return false;
+  }
+
+  bool isReplayableContraction(const HypernodeID rep_node, const HypernodeID contracted_node) const {
+    return rep_node < _hg.initialNumNodes() && contracted_node < _hg.initialNumNodes() &&
+           rep_node != contracted_node &&
+           _hg.nodeIsEnabled(rep_node) && _hg.nodeIsEnabled(contracted_node) &&
+           _hg.partID(rep_node) == _hg.partID(contracted_node) &&
+           (!_hg.isFixedVertex(contracted_node) ||
+            (_hg.isFixedVertex(rep_node) &&
+             _hg.fixedVertexPartID(rep_node) == _hg.fixedVertexPartID(contracted_node))) &&
+           _hg.nodeWeight(rep_node) + _hg.nodeWeight(contracted_node) <=
+           _context.coarsening.max_allowed_node_weight;
+  }
+
+  ContractionSequence contractionSequence() const {
+    ContractionSequence contractions;
+    contractions.reserve(_history.size());
+    for (const CoarseningMemento& memento : _history) {
+      contractions.emplace_back(memento.contraction_memento.u, memento.contraction_memento.v);
+    }
+    return contractions;
   }
 
   void removeSingleNodeHyperedges() {
@@ -96,6 +171,16 @@ class CoarsenerBase {
     // _context.stats.add(StatTag::Coarsening, "numRemovedParalellHEs", removed_parallel_hes);
   }
 
+  /*!
+   * Removes the parallel hyperedges incident to hn. They are logged with the last
+   * contraction of the history and thus restored before it is undone.
+   */
+  void removeParallelHyperedgesOf(const HypernodeID hn) {
+    CoarseningMemento memento(Hypergraph::ContractionMemento { hn, hn });
+    _hypergraph_pruner.removeParallelHyperedges(_hg, memento);
+    _history.back().parallel_hes_size += memento.parallel_hes_size;
+  }
+
   void restoreParallelHyperedges() {
     _hypergraph_pruner.restoreParallelHyperedges(_hg, _history.back());
   }
@@ -165,6 +250,14 @@ class CoarsenerBase {
     return improvement_found;
   }
 
+  void addMemoryConsumption(MemoryTreeNode* coarsener_node) const {
+    coarsener_node->addChild("Coarsening History",
+                             _history.capacity() * sizeof(CoarseningMemento));
+    coarsener_node->addChild("Max Node Weights",
+                             _max_hn_weights.capacity() * sizeof(CurrentMaxNodeWeight));
+    coarsener_node->addChild("Hypergraph Pruner", _hypergraph_pruner.memoryConsumption());
+  }
+
   void finalizeProgressBar() {
     const size_t remaining_nodes =
       static_cast<size_t>(_hg.initialNumNodes()) -
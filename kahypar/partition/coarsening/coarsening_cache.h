@@ -0,0 +1,191 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2018 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include "kahypar/definitions.h"
+#include "kahypar/macros.h"
+#include "kahypar/partition/coarsening/i_coarsener.h"
+#include "kahypar/partition/context.h"
+
+namespace kahypar {
+/*!
+ * Coarsening cache for repeated partitioning of the same hypergraph.
+ *
+ * The cache file stores the contraction sequence of a coarsening run. Since the
+ * hypergraph pruner removes single-node and parallel hyperedges deterministically
+ * after each contraction, replaying the sequence restores the complete coarsening
+ * history and the coarsest hypergraph without rating any vertex pairs.
+ *
+ * A cache is only used if the hypergraph (including weights, communities and fixed
+ * vertices) and the parameters of the coarsening algorithm match. The contraction
+ * limit and the maximum allowed node weight depend on k and epsilon and may differ:
+ * the longest prefix of the sequence that respects them is replayed and coarsening
+ * continues from there if necessary.
+ *
+ * File format: a coarsening_cache::Header followed by num_contractions pairs of
+ * HypernodeIDs (representative, contracted node).
+ */
+namespace coarsening_cache {
+static constexpr char kMagic[8] = { 'K', 'A', 'H', 'Y', 'P', 'A', 'R', 'C' };
+static constexpr uint32_t kVersion = 1;
+
+struct Header {
+  char magic[8];
+  uint32_t version;
+  uint32_t id_size;
+  uint64_t hypergraph_fingerprint;
+  uint64_t context_fingerprint;
+  uint64_t num_contractions;
+};
+
+static inline void combine(uint64_t& hash, const uint64_t value) {
+  hash ^= value + 0x9e3779b97f4a7c15 + (hash << 6) + (hash >> 2);
+}
+
+static inline uint64_t fingerprint(const Hypergraph& hypergraph) {
+  uint64_t hash = hypergraph.initialNumNodes();
+  combine(hash, hypergraph.initialNumEdges());
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    combine(hash, hn);
+    combine(hash, hypergraph.nodeWeight(hn));
+    combine(hash, hypergraph.communities()[hn]);
+    combine(hash, hypergraph.isFixedVertex(hn) ? hypergraph.fixedVertexPartID(hn) + 1 : 0);
+  }
+  for (const HyperedgeID& he : hypergraph.edges()) {
+    combine(hash, he);
+    combine(hash, hypergraph.edgeWeight(he));
+    for (const HypernodeID& pin : hypergraph.pins(he)) {
+      combine(hash, pin);
+    }
+  }
+  return hash;
+}
+
+// ! Fingerprint of all parameters that influence which contractions are chosen
+static inline uint64_t fingerprint(const Context& context) {
+  std::ostringstream parameters;
+  parameters << context.coarsening.algorithm << context.coarsening.rating
+             << context.coarsening.min_shrink_factor
+             << context.partition.seed << context.partition.hyperedge_size_threshold;
+  uint64_t hash = 0;
+  for (const char c : parameters.str()) {
+    combine(hash, static_cast<unsigned char>(c));
+  }
+  return hash;
+}
+
+// ! Returns false if there is no cache for the hypergraph and parameters in the file
+static inline bool read(const std::string& filename, const uint64_t hypergraph_fingerprint,
+                        const uint64_t context_fingerprint, ContractionSequence& contractions) {
+  std::ifstream in_stream(filename.c_str(), std::ios::binary);
+  Header header = { };
+  if (!in_stream.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+      memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 ||
+      header.version != kVersion ||
+      header.id_size != sizeof(HypernodeID) ||
+      header.hypergraph_fingerprint != hypergraph_fingerprint ||
+      header.context_fingerprint != context_fingerprint) {
+    return false;
+  }
+  contractions.resize(header.num_contractions);
+  for (auto& contraction : contractions) {
+    if (!in_stream.read(reinterpret_cast<char*>(&contraction.first), sizeof(HypernodeID)) ||
+        !in_stream.read(reinterpret_cast<char*>(&contraction.second), sizeof(HypernodeID))) {
+      contractions.clear();
+      return false;
+    }
+  }
+  return true;
+}
+
+/*!
+ * Writes the cache to a temporary file first, such that concurrent runs never
+ * read a partially written cache.
+ */
+static inline void write(const std::string& filename, const uint64_t hypergraph_fingerprint,
+                         const uint64_t context_fingerprint,
+                         const ContractionSequence& contractions) {
+  Header header = { };
+  memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = kVersion;
+  header.id_size = sizeof(HypernodeID);
+  header.hypergraph_fingerprint = hypergraph_fingerprint;
+  header.context_fingerprint = context_fingerprint;
+  header.num_contractions = contractions.size();
+
+  const std::string tmp_filename = filename + ".tmp";
+  std::ofstream out_stream(tmp_filename.c_str(), std::ios::binary);
+  out_stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  for (const auto& contraction : contractions) {
+    out_stream.write(reinterpret_cast<const char*>(&contraction.first), sizeof(HypernodeID));
+    out_stream.write(reinterpret_cast<const char*>(&contraction.second), sizeof(HypernodeID));
+  }
+  out_stream.close();
+  if (!out_stream || std::rename(tmp_filename.c_str(), filename.c_str()) != 0) {
+    std::remove(tmp_filename.c_str());
+    LOG << "Could not write coarsening cache" << filename;
+  }
+}
+
+// ! The cache is used for the initial coarsening of top-level direct k-way partitioning
+static inline bool isApplicable(const Context& context) {
+  return !context.partition.coarsening_cache_filename.empty() &&
+         context.type == ContextType::main &&
+         context.partition.mode == Mode::direct_kway &&
+         !context.partition_evolutionary;
+}
+
+/*!
+ * Coarsens the hypergraph by replaying the cached contractions. If coarsening had
+ * to continue after the replayed prefix, the cache is replaced by the new sequence.
+ * Since the prefix remains unchanged, the new sequence can still be replayed
+ * by all runs that were able to use the old one up to the same point.
+ */
+static inline void coarsen(const Hypergraph& hypergraph, ICoarsener& coarsener,
+                           const Context& context) {
+  const std::string& filename = context.partition.coarsening_cache_filename;
+  const uint64_t hypergraph_fingerprint = fingerprint(hypergraph);
+  const uint64_t context_fingerprint = fingerprint(context);
+
+  ContractionSequence cached_contractions;
+  read(filename, hypergraph_fingerprint, context_fingerprint, cached_contractions);
+  const size_t num_replayed = coarsener.coarsen(cached_contractions,
+                                                context.coarsening.contraction_limit);
+  const ContractionSequence contractions = coarsener.contractions();
+
+  if (context.partition.verbose_output && !context.partition.quiet_mode) {
+    LOG << "Replayed" << num_replayed << "of" << cached_contractions.size()
+        << "cached contractions";
+  }
+  if (contractions.size() > num_replayed) {
+    write(filename, hypergraph_fingerprint, context_fingerprint, contractions);
+  }
+}
+}  // namespace coarsening_cache
+}  // namespace kahypar
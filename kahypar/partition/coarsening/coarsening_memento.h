@@ -23,19 +23,21 @@
 #include "kahypar/definitions.h"
 
 namespace kahypar {
+/*!
+ * Undo information of a single coarsening step. Single-node and parallel hyperedges that
+ * are removed after a contraction are logged by the HypergraphPruner in LIFO order. Since
+ * coarsening steps are always undone in reverse order, the removed hyperedges of the most
+ * recent step are located at the end of these logs and it suffices to store their number.
+ */
 class CoarseningMemento {
  public:
   explicit CoarseningMemento(const Hypergraph::ContractionMemento& contraction_memento_) :
-    one_pin_hes_begin(0),
+    contraction_memento(contraction_memento_),
     one_pin_hes_size(0),
-    parallel_hes_begin(0),
-    parallel_hes_size(0),
-    contraction_memento(contraction_memento_) { }
+    parallel_hes_size(0) { }
 
-  int one_pin_hes_begin;        // start of removed single pin hyperedges
-  int one_pin_hes_size;         // # removed single pin hyperedges
-  int parallel_hes_begin;       // start of removed parallel hyperedges
-  int parallel_hes_size;        // # removed parallel hyperedges
   const Hypergraph::ContractionMemento contraction_memento;
+  HyperedgeID one_pin_hes_size;   // # removed single pin hyperedges
+  HyperedgeID parallel_hes_size;  // # removed parallel hyperedges
 };
 }  // namespace kahypar
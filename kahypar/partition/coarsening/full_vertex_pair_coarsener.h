@@ -130,10 +130,25 @@ class FullVertexPairCoarsener final : public ICoarsener,
     finalizeProgressBar();
   }
 
+  bool replayImpl(const ContractionSequence& contractions, const HypernodeID limit,
+                  size_t& num_replayed) override final {
+    return Base::replayContractions(contractions, limit, num_replayed);
+  }
+
+  ContractionSequence contractionsImpl() const override final {
+    return Base::contractionSequence();
+  }
+
   bool uncoarsenImpl(IRefiner& refiner) override final {
     return doUncoarsen(refiner);
   }
 
+  void memoryConsumptionImpl(MemoryTreeNode* parent) const override final {
+    MemoryTreeNode* coarsener_node = parent->addChild("Full Vertex Pair Coarsener");
+    Base::addMemoryConsumption(coarsener_node);
+    coarsener_node->addChild("Target", _target.capacity() * sizeof(HypernodeID));
+  }
+
   void reRateAffectedHypernodes(const HypernodeID rep_node,
                                 ds::FastResetFlagArray<>& rerated_hypernodes,
                                 ds::FastResetFlagArray<>& invalid_hypernodes) {
@@ -66,31 +66,29 @@ class HypergraphPruner {
 
   void restoreSingleNodeHyperedges(Hypergraph& hypergraph,
                                    const CoarseningMemento& memento) {
-    for (int i = memento.one_pin_hes_begin + memento.one_pin_hes_size - 1;
-         i >= memento.one_pin_hes_begin; --i) {
-      ASSERT(i >= 0 && static_cast<size_t>(i) < _removed_single_node_hyperedges.size(),
-             "Index out of bounds" << i);
+    ASSERT(memento.one_pin_hes_size <= _removed_single_node_hyperedges.size(),
+           V(memento.one_pin_hes_size) << V(_removed_single_node_hyperedges.size()));
+    for (HyperedgeID i = 0; i < memento.one_pin_hes_size; ++i) {
       DBG << "restore single-node HE "
-          << _removed_single_node_hyperedges[i];
-      hypergraph.restoreEdge(_removed_single_node_hyperedges[i]);
+          << _removed_single_node_hyperedges.back();
+      hypergraph.restoreEdge(_removed_single_node_hyperedges.back());
       _removed_single_node_hyperedges.pop_back();
     }
   }
 
   void restoreParallelHyperedges(Hypergraph& hypergraph,
                                  const CoarseningMemento& memento) {
-    for (int i = memento.parallel_hes_begin + memento.parallel_hes_size - 1;
-         i >= memento.parallel_hes_begin; --i) {
-      ASSERT(i >= 0 && static_cast<size_t>(i) < _removed_parallel_hyperedges.size(),
-             "Index out of bounds:" << i);
+    ASSERT(memento.parallel_hes_size <= _removed_parallel_hyperedges.size(),
+           V(memento.parallel_hes_size) << V(_removed_parallel_hyperedges.size()));
+    for (HyperedgeID i = 0; i < memento.parallel_hes_size; ++i) {
+      const ParallelHE& parallel_he = _removed_parallel_hyperedges.back();
       DBG << "restore HE "
-          << _removed_parallel_hyperedges[i].removed_id << "which is parallel to "
-          << _removed_parallel_hyperedges[i].representative_id;
-      hypergraph.restoreEdge(_removed_parallel_hyperedges[i].removed_id,
-                             _removed_parallel_hyperedges[i].representative_id);
-      hypergraph.setEdgeWeight(_removed_parallel_hyperedges[i].representative_id,
-                               hypergraph.edgeWeight(_removed_parallel_hyperedges[i].representative_id) -
-                               hypergraph.edgeWeight(_removed_parallel_hyperedges[i].removed_id));
+          << parallel_he.removed_id << "which is parallel to "
+          << parallel_he.representative_id;
+      hypergraph.restoreEdge(parallel_he.removed_id, parallel_he.representative_id);
+      hypergraph.setEdgeWeight(parallel_he.representative_id,
+                               hypergraph.edgeWeight(parallel_he.representative_id) -
+                               hypergraph.edgeWeight(parallel_he.removed_id));
       _removed_parallel_hyperedges.pop_back();
     }
   }
@@ -99,7 +97,6 @@ class HypergraphPruner {
                                              CoarseningMemento& memento) {
     // ASSERT(_history.top().contraction_memento.u == u,
     //        "Current coarsening memento does not belong to hypernode" << u);
-    memento.one_pin_hes_begin = _removed_single_node_hyperedges.size();
     auto begin_it = hypergraph.incidentEdges(memento.contraction_memento.u).first;
     auto end_it = hypergraph.incidentEdges(memento.contraction_memento.u).second;
     HyperedgeWeight removed_he_weight = 0;
@@ -130,8 +127,6 @@ class HypergraphPruner {
   // checking if there are more fingerprints with the same hash value.
   HyperedgeID removeParallelHyperedges(Hypergraph& hypergraph,
                                        CoarseningMemento& memento) {
-    memento.parallel_hes_begin = _removed_parallel_hyperedges.size();
-
     createFingerprints(hypergraph, memento.contraction_memento.u);
     std::sort(_fingerprints.begin(), _fingerprints.end(),
               [](const Fingerprint& a, const Fingerprint& b) { return a.hash < b.hash; });
@@ -280,6 +275,14 @@ class HypergraphPruner {
     return _max_removed_single_node_he_weight;
   }
 
+  // ! Number of bytes allocated for the removal logs and the fingerprints
+  size_t memoryConsumption() const {
+    return _removed_single_node_hyperedges.capacity() * sizeof(HyperedgeID) +
+           _removed_parallel_hyperedges.capacity() * sizeof(ParallelHE) +
+           _fingerprints.capacity() * sizeof(Fingerprint) +
+           _contained_hypernodes.memoryConsumption();
+  }
+
  private:
   HyperedgeWeight _max_removed_single_node_he_weight;
   std::vector<HyperedgeID> _removed_single_node_hyperedges;
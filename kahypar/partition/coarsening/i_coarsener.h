@@ -21,13 +21,19 @@
 #pragma once
 
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "kahypar/definitions.h"
 #include "kahypar/macros.h"
+#include "kahypar/utils/memory_tree.h"
 
 namespace kahypar {
 class IRefiner;
 
+// ! Representative and contracted node of each contraction in the order they were performed
+using ContractionSequence = std::vector<std::pair<HypernodeID, HypernodeID> >;
+
 class ICoarsener {
  public:
   ICoarsener(const ICoarsener&) = delete;
@@ -39,10 +45,34 @@ class ICoarsener {
     coarsenImpl(limit);
   }
 
+  /*!
+   * Performs the contractions of a previously computed sequence in order until the
+   * limit is reached or a contraction would exceed the maximum allowed node weight.
+   * If the limit is not reached afterwards, coarsening continues as usual.
+   *
+   * \return the number of contractions taken from the sequence
+   */
+  size_t coarsen(const ContractionSequence& contractions, const HypernodeID limit) {
+    size_t num_replayed = 0;
+    if (!replayImpl(contractions, limit, num_replayed)) {
+      coarsenImpl(limit);
+    }
+    return num_replayed;
+  }
+
+  // ! Contractions performed since the last uncoarsening, in order
+  ContractionSequence contractions() const {
+    return contractionsImpl();
+  }
+
   bool uncoarsen(IRefiner& refiner) {
     return uncoarsenImpl(refiner);
   }
 
+  void memoryConsumption(MemoryTreeNode* parent) const {
+    memoryConsumptionImpl(parent);
+  }
+
   virtual ~ICoarsener() = default;
 
  protected:
@@ -50,6 +80,14 @@ class ICoarsener {
 
  private:
   virtual void coarsenImpl(const HypernodeID limit) = 0;
+  // ! Returns true if the limit was reached by the replayed contractions
+  virtual bool replayImpl(const ContractionSequence&, const HypernodeID, size_t&) {
+    return false;
+  }
+  virtual ContractionSequence contractionsImpl() const {
+    return ContractionSequence();
+  }
   virtual bool uncoarsenImpl(IRefiner& refiner) = 0;
+  virtual void memoryConsumptionImpl(MemoryTreeNode*) const { }
 };
 }  // namespace kahypar
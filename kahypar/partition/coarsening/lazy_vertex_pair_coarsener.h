@@ -127,10 +127,26 @@ class LazyVertexPairCoarsener final : public ICoarsener,
     Base::finalizeProgressBar();
   }
 
+  bool replayImpl(const ContractionSequence& contractions, const HypernodeID limit,
+                  size_t& num_replayed) override final {
+    return Base::replayContractions(contractions, limit, num_replayed);
+  }
+
+  ContractionSequence contractionsImpl() const override final {
+    return Base::contractionSequence();
+  }
+
   bool uncoarsenImpl(IRefiner& refiner) override final {
     return Base::doUncoarsen(refiner);
   }
 
+  void memoryConsumptionImpl(MemoryTreeNode* parent) const override final {
+    MemoryTreeNode* coarsener_node = parent->addChild("Lazy Vertex Pair Coarsener");
+    Base::addMemoryConsumption(coarsener_node);
+    coarsener_node->addChild("Target", _target.capacity() * sizeof(HypernodeID));
+    coarsener_node->addChild("Outdated Ratings", _outdated_rating.memoryConsumption());
+  }
+
   void invalidateAffectedHypernodes(const HypernodeID rep_node) {
     for (const HyperedgeID& he : _hg.incidentEdges(rep_node)) {
       for (const HypernodeID& pin : _hg.pins(he)) {
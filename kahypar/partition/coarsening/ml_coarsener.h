@@ -20,13 +20,16 @@
 
 #pragma once
 
+#include <algorithm>
 #include <limits>
 #include <string>
+#include <utility>
 #include <vector>
 
 
 #include "kahypar/definitions.h"
 #include "kahypar/macros.h"
+#include "kahypar/partition/coarsening/i_coarsener.h"
 #include "kahypar/partition/coarsening/policies/fixed_vertex_acceptance_policy.h"
 #include "kahypar/partition/coarsening/policies/rating_acceptance_policy.h"
 #include "kahypar/partition/coarsening/policies/rating_community_policy.h"
@@ -34,9 +37,18 @@
 #include "kahypar/partition/coarsening/policies/rating_partition_policy.h"
 #include "kahypar/partition/coarsening/policies/rating_score_policy.h"
 #include "kahypar/partition/coarsening/policies/rating_tie_breaking_policy.h"
+#include "kahypar/partition/coarsening/vertex_pair_coarsener_base.h"
 #include "kahypar/partition/coarsening/vertex_pair_rater.h"
 
 namespace kahypar {
+/*!
+ * If a pass shrinks the hypergraph by less than context.coarsening.min_shrink_factor,
+ * the hypernodes that did not find a partner in that pass are contracted by two-hop
+ * matching: on power-law instances, the leaves around a hub can not be matched once
+ * the hub has reached the maximum node weight, but they can be clustered with each
+ * other. Each such hypernode is therefore grouped with the other unmatched hypernodes
+ * that share its neighbor of highest degree. Isolated hypernodes form a single group.
+ */
 template <class ScorePolicy = HeavyEdgeScore,
           class HeavyNodePenaltyPolicy = NoWeightPenalty,
           class CommunityPolicy = UseCommunityStructure,
@@ -50,6 +62,7 @@ class MLCoarsener final : public ICoarsener,
   static constexpr bool debug = false;
 
   static constexpr HypernodeID kInvalidTarget = std::numeric_limits<HypernodeID>::max();
+  static constexpr HypernodeID kNoHub = std::numeric_limits<HypernodeID>::max();
 
   using Base = VertexPairCoarsenerBase;
   using Rater = VertexPairRater<ScorePolicy,
@@ -65,7 +78,9 @@ class MLCoarsener final : public ICoarsener,
   MLCoarsener(Hypergraph& hypergraph, const Context& context,
               const HypernodeWeight weight_of_heaviest_node) :
     Base(hypergraph, context, weight_of_heaviest_node),
-    _rater(_hg, _context) { }
+    _rater(_hg, _context),
+    _stalled_hns(),
+    _hubs() { }
 
   ~MLCoarsener() override = default;
 
@@ -78,12 +93,14 @@ class MLCoarsener final : public ICoarsener,
  private:
   void coarsenImpl(const HypernodeID limit) override final {
     int pass_nr = 0;
+    HypernodeID num_two_hop_contractions = 0;
     std::vector<HypernodeID> current_hns;
     while (_hg.currentNumFreeVertices() > limit) {
       DBG << V(pass_nr);
       DBG << V(_hg.currentNumNodes());
       DBG << V(_hg.currentNumEdges());
       _rater.resetMatches();
+      _stalled_hns.clear();
       current_hns.clear();
       const HypernodeID num_hns_before_pass = _hg.currentNumNodes();
       for (const HypernodeID& hn : _hg.nodes()) {
@@ -109,6 +126,8 @@ class MLCoarsener final : public ICoarsener,
             // } else {
             //   contract(rating.target, hn);
             // }
+          } else {
+            _stalled_hns.push_back(hn);
           }
 
           if (_hg.currentNumFreeVertices() <= limit) {
@@ -117,23 +136,109 @@ class MLCoarsener final : public ICoarsener,
         }
       }
 
+      if (_hg.currentNumFreeVertices() > limit &&
+          num_hns_before_pass < _context.coarsening.min_shrink_factor * _hg.currentNumNodes()) {
+        num_two_hop_contractions += contractTwoHopNeighbors(limit);
+      }
+
       if (num_hns_before_pass == _hg.currentNumNodes()) {
         break;
       }
       ++pass_nr;
     }
 
+    _context.stats.set(StatTag::Coarsening, "numPasses", pass_nr);
+    _context.stats.set(StatTag::Coarsening, "numTwoHopContractions", num_two_hop_contractions);
+    if (!_context.partition.quiet_mode && _context.partition.verbose_output &&
+        _context.type == ContextType::main) {
+      LOG << "Coarsening passes =" << pass_nr;
+      LOG << "Two-hop contractions =" << num_two_hop_contractions;
+    }
+
     finalizeProgressBar();
   }
 
+  // ! Returns the number of contractions
+  HypernodeID contractTwoHopNeighbors(const HypernodeID limit) {
+    _hubs.clear();
+    for (const HypernodeID& hn : _stalled_hns) {
+      // Stalled hypernodes can still have been contracted into others later in the pass
+      if (_hg.nodeIsEnabled(hn)) {
+        _hubs.emplace_back(hub(hn), hn);
+      }
+    }
+    // Stable, such that each group remains in the random order of the pass
+    std::stable_sort(_hubs.begin(), _hubs.end(),
+                     [](const std::pair<HypernodeID, HypernodeID>& lhs,
+                        const std::pair<HypernodeID, HypernodeID>& rhs) {
+          return lhs.first < rhs.first;
+        });
+
+    HypernodeID num_contractions = 0;
+    for (size_t i = 0; i < _hubs.size() && _hg.currentNumFreeVertices() > limit; ++i) {
+      const HypernodeID hn = _hubs[i].second;
+      const bool same_group = i > 0 && _hubs[i - 1].first == _hubs[i].first;
+      if (same_group && isAdmissibleContraction(_hubs[i - 1].second, hn)) {
+        performContraction(_hubs[i - 1].second, hn);
+        // The representative becomes the partner of the next hypernode in the group
+        _hubs[i].second = _hubs[i - 1].second;
+        ++num_contractions;
+      }
+    }
+    DBG << V(_hubs.size()) << V(num_contractions);
+    return num_contractions;
+  }
+
+  // ! Neighbor of highest degree or kNoHub if the hypernode has no neighbors
+  HypernodeID hub(const HypernodeID hn) const {
+    HypernodeID hub = kNoHub;
+    HyperedgeID max_degree = 0;
+    for (const HyperedgeID& he : _hg.incidentEdges(hn)) {
+      if (_hg.edgeSize(he) <= _context.partition.hyperedge_size_threshold) {
+        for (const HypernodeID& pin : _hg.pins(he)) {
+          if (pin != hn && _hg.nodeDegree(pin) > max_degree) {
+            hub = pin;
+            max_degree = _hg.nodeDegree(pin);
+          }
+        }
+      }
+    }
+    return hub;
+  }
+
+  bool isAdmissibleContraction(const HypernodeID rep_node,
+                               const HypernodeID contracted_node) const {
+    return _hg.nodeWeight(rep_node) + _hg.nodeWeight(contracted_node) <=
+           _context.coarsening.max_allowed_node_weight &&
+           CommunityPolicy::sameCommunity(_hg.communities(), rep_node, contracted_node) &&
+           RatingPartitionPolicy::accept(_hg, _context, rep_node, contracted_node) &&
+           FixedVertexPolicy::acceptContraction(_hg, _context, rep_node, contracted_node);
+  }
+
+  bool replayImpl(const ContractionSequence& contractions, const HypernodeID limit,
+                  size_t& num_replayed) override final {
+    return Base::replayContractions(contractions, limit, num_replayed);
+  }
+
+  ContractionSequence contractionsImpl() const override final {
+    return Base::contractionSequence();
+  }
+
   bool uncoarsenImpl(IRefiner& refiner) override final {
     return doUncoarsen(refiner);
   }
 
+  void memoryConsumptionImpl(MemoryTreeNode* parent) const override final {
+    MemoryTreeNode* coarsener_node = parent->addChild("ML Coarsener");
+    Base::addMemoryConsumption(coarsener_node);
+  }
+
   using Base::_pq;
   using Base::_hg;
   using Base::_context;
   using Base::_history;
   Rater _rater;
+  std::vector<HypernodeID> _stalled_hns;
+  std::vector<std::pair<HypernodeID, HypernodeID> > _hubs;
 };
 }  // namespace kahypar
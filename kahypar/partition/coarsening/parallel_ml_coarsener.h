@@ -0,0 +1,392 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2018 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "kahypar/datastructure/fast_reset_flag_array.h"
+#include "kahypar/definitions.h"
+#include "kahypar/macros.h"
+#include "kahypar/meta/int_to_type.h"
+#include "kahypar/partition/coarsening/i_coarsener.h"
+#include "kahypar/partition/coarsening/policies/fixed_vertex_acceptance_policy.h"
+#include "kahypar/partition/coarsening/policies/rating_acceptance_policy.h"
+#include "kahypar/partition/coarsening/policies/rating_community_policy.h"
+#include "kahypar/partition/coarsening/policies/rating_heavy_node_penalty_policy.h"
+#include "kahypar/partition/coarsening/policies/rating_partition_policy.h"
+#include "kahypar/partition/coarsening/policies/rating_score_policy.h"
+#include "kahypar/partition/coarsening/policies/rating_tie_breaking_policy.h"
+#include "kahypar/partition/coarsening/vertex_pair_coarsener_base.h"
+#include "kahypar/partition/coarsening/vertex_pair_rater.h"
+#include "kahypar/utils/parallel_for.h"
+
+namespace kahypar {
+/*!
+ * Parallel variant of the MLCoarsener.
+ *
+ * Each pass first rates all hypernodes concurrently. The hypernodes are split into
+ * chunks of the shuffled order and each thread uses its own VertexPairRater, since
+ * the rating map is scratch memory of O(n) per rater. Raters share the score cache
+ * of the first rater, which is refreshed in parallel before rating, so that cached
+ * scores only cost O(m) memory once. The tie breaking is seeded per hypernode, such
+ * that the ratings do not depend on the number of threads.
+ *
+ * Afterwards, the ratings are resolved into clusters of arbitrary size in the
+ * shuffled order: a hypernode joins the cluster of its target if the weight of
+ * both clusters together does not exceed the maximum node weight. The clusters are
+ * contracted in rounds, each of which contracts the next member of every cluster.
+ * The contractions of a round whose contracted hypernodes do not share a hyperedge
+ * modify disjoint parts of the hypergraph and are performed concurrently (see
+ * GenericHypergraph::contractConcurrently). Since they commute, the result is the
+ * same as if they were performed in the shuffled order, which keeps coarsening
+ * deterministic. The remaining contractions of the round follow sequentially.
+ * Parallel hyperedges are removed once per pass after the last round. Since the
+ * ratings of a pass refer to the hypergraph at its start, the fixed vertex
+ * constraints are checked again for each contraction.
+ */
+template <class ScorePolicy = HeavyEdgeScore,
+          class HeavyNodePenaltyPolicy = NoWeightPenalty,
+          class CommunityPolicy = UseCommunityStructure,
+          class RatingPartitionPolicy = NormalPartitionPolicy,
+          class AcceptancePolicy = BestRatingPreferringUnmatched<>,
+          class FixedVertexPolicy = AllowFreeOnFixedFreeOnFreeFixedOnFixed,
+          typename RatingType = RatingType>
+class ParallelMLCoarsener final : public ICoarsener,
+                                  private VertexPairCoarsenerBase<>{
+ private:
+  static constexpr bool debug = false;
+
+  static constexpr HypernodeID kInvalidNode = std::numeric_limits<HypernodeID>::max();
+  static constexpr size_t kMinHypernodesPerThread = 1 << 12;
+  static constexpr size_t kMinHyperedgesPerThread = 1 << 14;
+  static constexpr size_t kMinContractionsPerThread = 1 << 10;
+  static constexpr bool kContractsConcurrently =
+    Hypergraph::IncidentNetStorage::kSupportsConcurrentAppends;
+
+  using Base = VertexPairCoarsenerBase;
+  using Memento = Hypergraph::ContractionMemento;
+  using Rater = VertexPairRater<ScorePolicy,
+                                HeavyNodePenaltyPolicy,
+                                CommunityPolicy,
+                                RatingPartitionPolicy,
+                                typename ConcurrentAcceptancePolicy<AcceptancePolicy>::Type,
+                                FixedVertexPolicy,
+                                RatingType>;
+  using Rating = typename Rater::Rating;
+
+  struct RatingChunk {
+    size_t begin;
+    size_t end;
+    Rater* rater;
+  };
+
+  struct ContractionChunk {
+    size_t begin;
+    size_t end;
+  };
+
+ public:
+  ParallelMLCoarsener(Hypergraph& hypergraph, const Context& context,
+                      const HypernodeWeight weight_of_heaviest_node) :
+    Base(hypergraph, context, weight_of_heaviest_node),
+    _raters(),
+    _target(_hg.initialNumNodes(), kInvalidNode),
+    _representative(_hg.initialNumNodes()),
+    _cluster_weight(_hg.initialNumNodes()),
+    _first_member(_hg.initialNumNodes()),
+    _next_member(_hg.initialNumNodes()),
+    _clusters(),
+    _contracted_clusters(),
+    _concurrent_contractions(),
+    _sequential_contractions(),
+    _contracted_hyperedges(_hg.initialNumEdges()) { }
+
+  ~ParallelMLCoarsener() override = default;
+
+  ParallelMLCoarsener(const ParallelMLCoarsener&) = delete;
+  ParallelMLCoarsener& operator= (const ParallelMLCoarsener&) = delete;
+
+  ParallelMLCoarsener(ParallelMLCoarsener&&) = delete;
+  ParallelMLCoarsener& operator= (ParallelMLCoarsener&&) = delete;
+
+ private:
+  void coarsenImpl(const HypernodeID limit) override final {
+    int pass_nr = 0;
+    std::vector<HypernodeID> current_hns;
+    while (_hg.currentNumFreeVertices() > limit) {
+      DBG << V(pass_nr);
+      DBG << V(_hg.currentNumNodes());
+      DBG << V(_hg.currentNumEdges());
+      current_hns.clear();
+      const HypernodeID num_hns_before_pass = _hg.currentNumNodes();
+      for (const HypernodeID& hn : _hg.nodes()) {
+        current_hns.push_back(hn);
+      }
+      Randomize::instance().shuffleVector(current_hns, current_hns.size());
+
+      rateInParallel(current_hns, pass_nr);
+      formClusters(current_hns);
+      contractClusters(current_hns, limit);
+
+      if (num_hns_before_pass == _hg.currentNumNodes()) {
+        break;
+      }
+      ++pass_nr;
+    }
+
+    finalizeProgressBar();
+  }
+
+  void rateInParallel(const std::vector<HypernodeID>& hns, const int pass_nr) {
+    std::vector<RatingChunk> chunks(utils::numThreads(hns.size(), kMinHypernodesPerThread));
+    if (_raters.empty()) {
+      _raters.emplace_back(new Rater(_hg, _context));
+    }
+    while (_raters.size() < chunks.size()) {
+      _raters.emplace_back(new Rater(_hg, _context, *_raters.front()));
+    }
+    if (ScorePolicy::kCacheScores && chunks.size() > 1) {
+      refreshScores();
+    }
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      chunks[i].begin = i * hns.size() / chunks.size();
+      chunks[i].end = (i + 1) * hns.size() / chunks.size();
+      chunks[i].rater = _raters[i].get();
+    }
+    const uint64_t pass_seed = combineSeed(_context.partition.seed, pass_nr);
+    utils::parallelForEach(chunks, [&](const RatingChunk& chunk) {
+        for (size_t i = chunk.begin; i < chunk.end; ++i) {
+          const HypernodeID hn = hns[i];
+          SeededRandomRatingWins::seed(combineSeed(pass_seed, hn));
+          const Rating rating = chunk.rater->rate(hn);
+          _target[hn] = rating.valid ? rating.target : kInvalidNode;
+        }
+      });
+  }
+
+  // ! Brings the shared score cache up to date, such that rating does not write to it
+  void refreshScores() {
+    std::vector<RatingChunk> chunks(utils::numThreads(_hg.initialNumEdges(),
+                                                      kMinHyperedgesPerThread));
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      chunks[i].begin = i * _hg.initialNumEdges() / chunks.size();
+      chunks[i].end = (i + 1) * _hg.initialNumEdges() / chunks.size();
+      chunks[i].rater = _raters.front().get();
+    }
+    utils::parallelForEach(chunks, [](const RatingChunk& chunk) {
+        chunk.rater->refreshScores(chunk.begin, chunk.end);
+      });
+  }
+
+  // ! Links the members of each cluster in the shuffled order, starting at _first_member[rep]
+  void formClusters(const std::vector<HypernodeID>& hns) {
+    for (const HypernodeID& hn : hns) {
+      _representative[hn] = hn;
+      _cluster_weight[hn] = _hg.nodeWeight(hn);
+      _first_member[hn] = kInvalidNode;
+    }
+    for (const HypernodeID& hn : hns) {
+      if (_target[hn] != kInvalidNode) {
+        const HypernodeID rep_node = representative(hn);
+        const HypernodeID other_rep_node = representative(_target[hn]);
+        if (rep_node != other_rep_node &&
+            _cluster_weight[rep_node] + _cluster_weight[other_rep_node] <=
+            _context.coarsening.max_allowed_node_weight) {
+          _representative[other_rep_node] = rep_node;
+          _cluster_weight[rep_node] += _cluster_weight[other_rep_node];
+        }
+      }
+    }
+    for (auto it = hns.rbegin(); it != hns.rend(); ++it) {
+      const HypernodeID rep_node = representative(*it);
+      if (rep_node != *it) {
+        _next_member[*it] = _first_member[rep_node];
+        _first_member[rep_node] = *it;
+      }
+    }
+  }
+
+  void contractClusters(const std::vector<HypernodeID>& hns, const HypernodeID limit) {
+    _clusters.clear();
+    _contracted_clusters.clear();
+    for (const HypernodeID& hn : hns) {
+      if (_first_member[hn] != kInvalidNode) {
+        _clusters.push_back(hn);
+      }
+    }
+    while (!_clusters.empty() && _hg.currentNumFreeVertices() > limit) {
+      selectContractions(limit);
+      contractConcurrently(meta::Int2Type<kContractsConcurrently>());
+      for (const Memento& memento : _sequential_contractions) {
+        performClusterContraction(memento.u, memento.v);
+      }
+    }
+    std::sort(_contracted_clusters.begin(), _contracted_clusters.end());
+    _contracted_clusters.erase(std::unique(_contracted_clusters.begin(),
+                                           _contracted_clusters.end()),
+                               _contracted_clusters.end());
+    for (const HypernodeID& rep_node : _contracted_clusters) {
+      removeParallelHyperedgesOf(rep_node);
+    }
+  }
+
+  /*!
+   * Selects the next admissible member of each cluster for the current round. Members
+   * that share a hyperedge with a member selected before are contracted sequentially.
+   * Clusters without further members are removed from _clusters.
+   */
+  void selectContractions(const HypernodeID limit) {
+    _concurrent_contractions.clear();
+    _sequential_contractions.clear();
+    _contracted_hyperedges.reset();
+    const HypernodeID max_num_contractions = _hg.currentNumFreeVertices() - limit;
+    HypernodeID num_contractions = 0;
+    size_t num_clusters = 0;
+    for (const HypernodeID& rep_node : _clusters) {
+      HypernodeID& hn = _first_member[rep_node];
+      while (hn != kInvalidNode && !isAdmissibleContraction(rep_node, hn)) {
+        hn = _next_member[hn];
+      }
+      if (hn != kInvalidNode && num_contractions < max_num_contractions) {
+        if (sharesContractedHyperedge(hn)) {
+          _sequential_contractions.push_back(Memento { rep_node, hn });
+        } else {
+          for (const HyperedgeID& he : _hg.incidentEdges(hn)) {
+            _contracted_hyperedges.set(he, true);
+          }
+          _concurrent_contractions.push_back(Memento { rep_node, hn });
+        }
+        // Contracting a fixed vertex does not reduce the number of free vertices
+        if (!_hg.isFixedVertex(hn)) {
+          ++num_contractions;
+        }
+        _contracted_clusters.push_back(rep_node);
+        hn = _next_member[hn];
+      }
+      if (hn != kInvalidNode) {
+        _clusters[num_clusters++] = rep_node;
+      }
+    }
+    _clusters.resize(num_clusters);
+  }
+
+  bool sharesContractedHyperedge(const HypernodeID hn) const {
+    for (const HyperedgeID& he : _hg.incidentEdges(hn)) {
+      if (_contracted_hyperedges[he]) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void contractConcurrently(meta::Int2Type<true>) {
+    if (_concurrent_contractions.empty()) {
+      return;
+    }
+    const HypernodeID num_nodes = _hg.currentNumNodes();
+    std::vector<ContractionChunk> chunks(
+      utils::numThreads(_concurrent_contractions.size(), kMinContractionsPerThread));
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      chunks[i].begin = i * _concurrent_contractions.size() / chunks.size();
+      chunks[i].end = (i + 1) * _concurrent_contractions.size() / chunks.size();
+    }
+    _hg.beginConcurrentContractions();
+    utils::parallelForEach(chunks, [&](const ContractionChunk& chunk) {
+        for (size_t i = chunk.begin; i < chunk.end; ++i) {
+          _hg.contractConcurrently(_concurrent_contractions[i].u, _concurrent_contractions[i].v);
+        }
+      });
+    _hg.endConcurrentContractions();
+    for (size_t i = 0; i < _concurrent_contractions.size(); ++i) {
+      addContraction(_concurrent_contractions[i], num_nodes - i - 1);
+    }
+  }
+
+  // The incident net storage does not support concurrent contractions
+  void contractConcurrently(meta::Int2Type<false>) {
+    for (const Memento& memento : _concurrent_contractions) {
+      performClusterContraction(memento.u, memento.v);
+    }
+  }
+
+  HypernodeID representative(HypernodeID hn) {
+    while (_representative[hn] != hn) {
+      _representative[hn] = _representative[_representative[hn]];
+      hn = _representative[hn];
+    }
+    return hn;
+  }
+
+  bool isAdmissibleContraction(const HypernodeID rep_node,
+                               const HypernodeID contracted_node) const {
+    return rep_node != contracted_node &&
+           _hg.nodeWeight(rep_node) + _hg.nodeWeight(contracted_node) <=
+           _context.coarsening.max_allowed_node_weight &&
+           CommunityPolicy::sameCommunity(_hg.communities(), rep_node, contracted_node) &&
+           RatingPartitionPolicy::accept(_hg, _context, rep_node, contracted_node) &&
+           FixedVertexPolicy::acceptContraction(_hg, _context, rep_node, contracted_node);
+  }
+
+  static uint64_t combineSeed(const uint64_t seed, const uint64_t value) {
+    return seed ^ (value + 0x9e3779b97f4a7c15 + (seed << 6) + (seed >> 2));
+  }
+
+  bool replayImpl(const ContractionSequence& contractions, const HypernodeID limit,
+                  size_t& num_replayed) override final {
+    return Base::replayContractions(contractions, limit, num_replayed);
+  }
+
+  ContractionSequence contractionsImpl() const override final {
+    return Base::contractionSequence();
+  }
+
+  bool uncoarsenImpl(IRefiner& refiner) override final {
+    return doUncoarsen(refiner);
+  }
+
+  void memoryConsumptionImpl(MemoryTreeNode* parent) const override final {
+    MemoryTreeNode* coarsener_node = parent->addChild("Parallel ML Coarsener");
+    Base::addMemoryConsumption(coarsener_node);
+  }
+
+  using Base::_pq;
+  using Base::_hg;
+  using Base::_context;
+  using Base::_history;
+  std::vector<std::unique_ptr<Rater> > _raters;
+  std::vector<HypernodeID> _target;
+  std::vector<HypernodeID> _representative;
+  std::vector<HypernodeWeight> _cluster_weight;
+  std::vector<HypernodeID> _first_member;
+  std::vector<HypernodeID> _next_member;
+  // representatives of the clusters that still have members to contract
+  std::vector<HypernodeID> _clusters;
+  std::vector<HypernodeID> _contracted_clusters;
+  std::vector<Memento> _concurrent_contractions;
+  std::vector<Memento> _sequential_contractions;
+  ds::FastResetFlagArray<> _contracted_hyperedges;
+};
+}  // namespace kahypar
@@ -59,4 +59,20 @@ class BestRatingPreferringUnmatched final : public meta::PolicyBase {
 
 using AcceptancePolicies = meta::Typelist<BestRatingWithTieBreaking<>,
                                           BestRatingPreferringUnmatched<> >;
+
+// ! Acceptance policy for raters that run concurrently, see SeededRandomRatingWins
+template <class AcceptancePolicy>
+struct ConcurrentAcceptancePolicy {
+  using Type = AcceptancePolicy;
+};
+
+template <>
+struct ConcurrentAcceptancePolicy<BestRatingWithTieBreaking<RandomRatingWins> > {
+  using Type = BestRatingWithTieBreaking<SeededRandomRatingWins>;
+};
+
+template <>
+struct ConcurrentAcceptancePolicy<BestRatingPreferringUnmatched<RandomRatingWins> > {
+  using Type = BestRatingPreferringUnmatched<SeededRandomRatingWins>;
+};
 }  // namespace kahypar
@@ -26,8 +26,12 @@
 #include "kahypar/partition/context.h"
 
 namespace kahypar {
+// kCacheScores: whether computing the score is expensive enough to be worth caching it per
+// hyperedge (see VertexPairRater)
 class HeavyEdgeScore final : public meta::PolicyBase {
  public:
+  static constexpr bool kCacheScores = false;
+
   KAHYPAR_ATTRIBUTE_ALWAYS_INLINE static inline RatingType score(const Hypergraph& hypergraph,
                                                                  const HyperedgeID he,
                                                                  const Context&) {
@@ -37,6 +41,8 @@ class HeavyEdgeScore final : public meta::PolicyBase {
 
 class EdgeFrequencyScore final : public meta::PolicyBase {
  public:
+  static constexpr bool kCacheScores = true;
+
   KAHYPAR_ATTRIBUTE_ALWAYS_INLINE static inline RatingType score(const Hypergraph& hypergraph,
                                                                  const HyperedgeID he,
                                                                  const Context& context) {
@@ -20,6 +20,9 @@
 
 #pragma once
 
+#include <cstdint>
+
+#include "kahypar/macros.h"
 #include "kahypar/utils/randomize.h"
 
 namespace kahypar {
@@ -70,4 +73,39 @@ class RandomRatingWins {
  protected:
   ~RandomRatingWins() = default;
 };
+
+/*!
+ * Random tie breaking for raters that run concurrently. Each thread has its own
+ * generator, which is seeded before a rating such that the result does not
+ * depend on the thread that computes it.
+ */
+class SeededRandomRatingWins {
+ public:
+  static void seed(const uint64_t seed) {
+    state() = seed;
+  }
+
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE static bool acceptEqual() {
+    // splitmix64
+    uint64_t z = (state() += 0x9e3779b97f4a7c15);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+    return ((z ^ (z >> 31)) & 1) != 0;
+  }
+
+  SeededRandomRatingWins(const SeededRandomRatingWins&) = delete;
+  SeededRandomRatingWins& operator= (const SeededRandomRatingWins&) = delete;
+
+  SeededRandomRatingWins(SeededRandomRatingWins&&) = delete;
+  SeededRandomRatingWins& operator= (SeededRandomRatingWins&&) = delete;
+
+ protected:
+  ~SeededRandomRatingWins() = default;
+
+ private:
+  static uint64_t& state() {
+    static thread_local uint64_t state = 0;
+    return state;
+  }
+};
 }  // namespace kahypar
@@ -202,6 +202,11 @@ class VertexPairCoarsenerBase : public CoarsenerBase {
     }
   }
 
+  void addMemoryConsumption(MemoryTreeNode* coarsener_node) const {
+    CoarsenerBase::addMemoryConsumption(coarsener_node);
+    coarsener_node->addChild("Priority Queue", _pq.memoryConsumption());
+  }
+
   void createHypernodePermutation(std::vector<HypernodeID>& permutation) {
     permutation.reserve(_hg.initialNumNodes());
     for (const HypernodeID& hn : _hg.nodes()) {
@@ -21,6 +21,7 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <limits>
 #include <stack>
 #include <vector>
@@ -50,6 +51,9 @@ class VertexPairRater {
  private:
   static constexpr bool debug = false;
 
+  // Hypernodes with at most this many neighbor visits are rated with a dense accumulator
+  static constexpr size_t kSmallNeighborhoodSize = 32;
+
   class VertexPairRating {
  public:
     VertexPairRating(HypernodeID trgt, RatingType val, bool is_valid) :
@@ -78,11 +82,41 @@ class VertexPairRater {
  public:
   using Rating = VertexPairRating;
 
+ private:
+  // Hyperedges always have at least two pins when they are rated, so size 0 marks empty entries
+  struct CachedScore {
+    RatingType score;
+    HypernodeID size;
+    HyperedgeWeight weight;
+  };
+
+ public:
+
   VertexPairRater(Hypergraph& hypergraph, const Context& context) :
     _hg(hypergraph),
     _context(context),
     _tmp_ratings(_hg.initialNumNodes()),
-    _already_matched(_hg.initialNumNodes()) { }
+    _already_matched(_hg.initialNumNodes()),
+    _small_neighbors(),
+    _small_ratings(),
+    _own_scores(ScorePolicy::kCacheScores ? _hg.initialNumEdges() : 0, CachedScore { 0, 0, 0 }),
+    _scores(_own_scores) { }
+
+  /*!
+   * Creates a rater that uses the score cache of owner instead of allocating its own.
+   * Raters sharing a cache may rate concurrently only if owner.refreshScores() was
+   * called for all hyperedges since the last change of the hypergraph, because the
+   * cache is not written in that case.
+   */
+  VertexPairRater(Hypergraph& hypergraph, const Context& context, VertexPairRater& owner) :
+    _hg(hypergraph),
+    _context(context),
+    _tmp_ratings(_hg.initialNumNodes()),
+    _already_matched(_hg.initialNumNodes()),
+    _small_neighbors(),
+    _small_ratings(),
+    _own_scores(),
+    _scores(owner._scores) { }
 
   VertexPairRater(const VertexPairRater&) = delete;
   VertexPairRater& operator= (const VertexPairRater&) = delete;
@@ -95,10 +129,17 @@ class VertexPairRater {
   VertexPairRating rate(const HypernodeID u) {
     DBG << "Calculating rating for HN" << u;
     const HypernodeWeight weight_u = _hg.nodeWeight(u);
+    if (hasSmallNeighborhood(u)) {
+      const size_t num_neighbors = accumulateSmallNeighborhood(u, weight_u);
+      return selectTarget(u, weight_u, num_neighbors,
+                          [&](const size_t i) { return _small_neighbors[i]; },
+                          [&](const size_t i) { return _small_ratings[i]; });
+    }
+
     for (const HyperedgeID& he : _hg.incidentEdges(u)) {
       ASSERT(_hg.edgeSize(he) > 1, V(he));
       if (_hg.edgeSize(he) <= _context.partition.hyperedge_size_threshold) {
-        const RatingType score = ScorePolicy::score(_hg, he, _context);
+        const RatingType score = cachedScore(he);
         for (const HypernodeID& v : _hg.pins(he)) {
           if (v != u && belowThresholdNodeWeight(weight_u, _hg.nodeWeight(v)) &&
               RatingPartitionPolicy::accept(_hg, _context, u, v)) {
@@ -108,15 +149,116 @@ class VertexPairRater {
       }
     }
 
+    VertexPairRating ret = selectTarget(
+      u, weight_u, _tmp_ratings.size(),
+      [&](const size_t i) { return (_tmp_ratings.begin() + i)->key; },
+      [&](const size_t i) { return (_tmp_ratings.begin() + i)->value; });
+    _tmp_ratings.clear();
+    return ret;
+  }
+
+  // ! Updates the cached scores of the enabled hyperedges in [begin, end). Can be called
+  // ! concurrently for disjoint ranges.
+  void refreshScores(const HyperedgeID begin, const HyperedgeID end) {
+    if (ScorePolicy::kCacheScores) {
+      for (HyperedgeID he = begin; he < end; ++he) {
+        if (_hg.edgeIsEnabled(he)) {
+          cachedScore(he);
+        }
+      }
+    }
+  }
+
+  void markAsMatched(const HypernodeID hn) {
+    _already_matched.set(hn, true);
+  }
+
+  void resetMatches() {
+    _already_matched.reset();
+  }
+
+  HypernodeWeight thresholdNodeWeight() const {
+    return _context.coarsening.max_allowed_node_weight;
+  }
+
+ private:
+  /*!
+   * The score of a hyperedge only changes if a contraction changes its size or the
+   * removal of a parallel hyperedge changes its weight. Expensive scores are therefore
+   * cached together with the size and weight they were computed for. For cheap scores,
+   * the additional random access to the cache costs more than it saves.
+   */
+  RatingType cachedScore(const HyperedgeID he) {
+    if (!ScorePolicy::kCacheScores) {
+      return ScorePolicy::score(_hg, he, _context);
+    }
+    CachedScore& cached = _scores[he];
+    if (cached.size != _hg.edgeSize(he) || cached.weight != _hg.edgeWeight(he)) {
+      cached = CachedScore { ScorePolicy::score(_hg, he, _context),
+                             _hg.edgeSize(he), _hg.edgeWeight(he) };
+    }
+    return cached.score;
+  }
+
+  bool hasSmallNeighborhood(const HypernodeID u) const {
+    size_t num_visits = 0;
+    for (const HyperedgeID& he : _hg.incidentEdges(u)) {
+      if (_hg.edgeSize(he) <= _context.partition.hyperedge_size_threshold) {
+        num_visits += _hg.edgeSize(he) - 1;
+        if (num_visits > kSmallNeighborhoodSize) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  /*!
+   * Accumulates the scores of the neighbors of u in the same order as the sparse map,
+   * such that both kernels select the same target. The lookup scans all neighbors
+   * without branching, which the compiler can vectorize and which is faster than the
+   * random accesses to the sparse map for small neighborhoods.
+   */
+  size_t accumulateSmallNeighborhood(const HypernodeID u, const HypernodeWeight weight_u) {
+    size_t num_neighbors = 0;
+    for (const HyperedgeID& he : _hg.incidentEdges(u)) {
+      ASSERT(_hg.edgeSize(he) > 1, V(he));
+      if (_hg.edgeSize(he) <= _context.partition.hyperedge_size_threshold) {
+        const RatingType score = cachedScore(he);
+        for (const HypernodeID& v : _hg.pins(he)) {
+          if (v != u && belowThresholdNodeWeight(weight_u, _hg.nodeWeight(v)) &&
+              RatingPartitionPolicy::accept(_hg, _context, u, v)) {
+            size_t pos = num_neighbors;
+            for (size_t i = 0; i < num_neighbors; ++i) {
+              pos = _small_neighbors[i] == v ? i : pos;
+            }
+            if (pos == num_neighbors) {
+              _small_neighbors[num_neighbors] = v;
+              _small_ratings[num_neighbors] = RatingType();
+              ++num_neighbors;
+            }
+            _small_ratings[pos] += score;
+          }
+        }
+      }
+    }
+    return num_neighbors;
+  }
+
+  // ! Selects the best of the accumulated neighbors, which are visited in reverse order
+  template <typename GetNeighbor, typename GetRating>
+  VertexPairRating selectTarget(const HypernodeID u, const HypernodeWeight weight_u,
+                                const size_t num_neighbors, const GetNeighbor& neighbor,
+                                const GetRating& rating) {
     RatingType max_rating = std::numeric_limits<RatingType>::min();
     HypernodeID target = std::numeric_limits<HypernodeID>::max();
-    for (auto it = _tmp_ratings.end() - 1; it >= _tmp_ratings.begin(); --it) {
-      const HypernodeID tmp_target = it->key;
+    for (size_t i = num_neighbors; i-- > 0; ) {
+      const HypernodeID tmp_target = neighbor(i);
       const HypernodeWeight target_weight = _hg.nodeWeight(tmp_target);
       HypernodeWeight penalty = HeavyNodePenaltyPolicy::penalty(weight_u,
                                                                 target_weight);
-      penalty = penalty == 0 ? std::max(std::max(weight_u, target_weight), 1) : penalty;
-      const RatingType tmp_rating = it->value / static_cast<double>(penalty);
+      penalty = penalty == 0 ? std::max(std::max(weight_u, target_weight), static_cast<HypernodeWeight>(1)) : penalty;
+      const RatingType tmp_rating = rating(i) / static_cast<double>(penalty);
       DBG << "r(" << u << "," << tmp_target << ")=" << tmp_rating;
       if (CommunityPolicy::sameCommunity(_hg.communities(), u, tmp_target) &&
           AcceptancePolicy::acceptRating(tmp_rating, max_rating,
@@ -136,24 +278,10 @@ class VertexPairRater {
       ASSERT(_hg.communities()[u] == _hg.communities()[ret.target]);
     }
     ASSERT(!ret.valid || (_hg.partID(u) == _hg.partID(ret.target)));
-    _tmp_ratings.clear();
     DBG << "rating=(" << ret.value << "," << ret.target << "," << ret.valid << ")";
     return ret;
   }
 
-  void markAsMatched(const HypernodeID hn) {
-    _already_matched.set(hn, true);
-  }
-
-  void resetMatches() {
-    _already_matched.reset();
-  }
-
-  HypernodeWeight thresholdNodeWeight() const {
-    return _context.coarsening.max_allowed_node_weight;
-  }
-
- private:
   bool belowThresholdNodeWeight(const HypernodeWeight weight_u,
                                 const HypernodeWeight weight_v) const {
     return weight_v + weight_u <= _context.coarsening.max_allowed_node_weight;
@@ -163,5 +291,9 @@ class VertexPairRater {
   const Context& _context;
   ds::SparseMap<HypernodeID, RatingType> _tmp_ratings;
   ds::FastResetFlagArray<> _already_matched;
+  std::array<HypernodeID, kSmallNeighborhoodSize> _small_neighbors;
+  std::array<RatingType, kSmallNeighborhoodSize> _small_ratings;
+  std::vector<CachedScore> _own_scores;
+  std::vector<CachedScore>& _scores;
 };
 }  // namespace kahypar
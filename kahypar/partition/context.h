@@ -23,6 +23,7 @@
 #include <array>
 #include <cctype>
 #include <cstdint>
+#include <future>
 #include <iomanip>
 #include <limits>
 #include <sstream>
@@ -30,6 +31,7 @@
 #include <vector>
 
 #include "kahypar/definitions.h"
+#include "kahypar/io/hypergraph_statistics.h"
 #include "kahypar/partition/context_enum_classes.h"
 #include "kahypar/partition/evolutionary/action.h"
 #include "kahypar/utils/stats.h"
@@ -145,6 +147,9 @@ struct CoarseningParameters {
   RatingParameters rating = { };
   HypernodeID contraction_limit_multiplier = std::numeric_limits<HypernodeID>::max();
   double max_allowed_weight_multiplier = std::numeric_limits<double>::max();
+  // ml_style passes that shrink the hypergraph by less than this factor are followed
+  // by two-hop matching of the hypernodes that could not be matched (0 = disabled)
+  double min_shrink_factor = 0.0;
 
   // Those will be determined dynamically
   HypernodeWeight max_allowed_node_weight = 0;
@@ -157,6 +162,7 @@ inline std::ostream& operator<< (std::ostream& str, const CoarseningParameters&
   str << "  Algorithm:                          " << params.algorithm << std::endl;
   str << "  max-allowed-weight-multiplier:      " << params.max_allowed_weight_multiplier << std::endl;
   str << "  contraction-limit-multiplier:       " << params.contraction_limit_multiplier << std::endl;
+  str << "  min-shrink-factor:                  " << params.min_shrink_factor << std::endl;
   str << "  hypernode weight fraction:          ";
   // For the coarsening algorithm of the initial partitioning phase
   // these parameters are only known after main coarsening.
@@ -329,16 +335,29 @@ struct PartitioningParameters {
   bool use_individual_part_weights = false;
   bool vcycle_refinement_for_input_partition = false;
   bool write_partition_file = false;
+  bool write_binary_partition_file = false;
+  InputFormat input_format = InputFormat::automatic;
+  MatrixModel matrix_model = MatrixModel::row_net;
 
   std::string graph_filename { };
   std::string graph_partition_filename { };
   std::string fixed_vertex_filename { };
   std::string input_partition_filename { };
+  std::string coarsening_cache_filename { };
+
+  // statistics of the input file, computed while the hypergraph is constructed
+  std::shared_future<io::HypergraphStats> input_stats { };
 };
 
 inline std::ostream& operator<< (std::ostream& str, const PartitioningParameters& params) {
   str << "Partitioning Parameters:" << std::endl;
   str << "  Hypergraph:                         " << params.graph_filename << std::endl;
+  if (params.input_format != InputFormat::automatic) {
+    str << "  Input Format:                       " << params.input_format << std::endl;
+  }
+  if (params.input_format == InputFormat::matrix_market) {
+    str << "  Matrix Model:                       " << params.matrix_model << std::endl;
+  }
   str << "  Partition File:                     " << params.graph_partition_filename << std::endl;
   if (!params.fixed_vertex_filename.empty()) {
     str << "  Fixed Vertex File:                  " << params.fixed_vertex_filename << std::endl;
@@ -346,6 +365,9 @@ inline std::ostream& operator<< (std::ostream& str, const PartitioningParameters
   if (!params.input_partition_filename.empty()) {
     str << "  Input Partition File:                  " << params.input_partition_filename << std::endl;
   }
+  if (!params.coarsening_cache_filename.empty()) {
+    str << "  Coarsening Cache File:              " << params.coarsening_cache_filename << std::endl;
+  }
   str << "  Mode:                               " << params.mode << std::endl;
   str << "  Objective:                          " << params.objective << std::endl;
   str << "  k:                                  " << params.k << std::endl;
@@ -82,6 +82,7 @@ enum class CoarseningAlgorithm : uint8_t {
   heavy_full,
   heavy_lazy,
   ml_style,
+  parallel_ml_style,
   do_nothing,
   UNDEFINED
 };
@@ -173,6 +174,20 @@ enum class FlowExecutionMode : uint8_t {
   UNDEFINED
 };
 
+enum class InputFormat : uint8_t {
+  automatic,
+  hmetis,
+  binary,
+  matrix_market,
+  patoh
+};
+
+enum class MatrixModel : uint8_t {
+  row_net,
+  column_net,
+  fine_grain
+};
+
 enum class FlowHypergraphSizeConstraint : uint8_t {
   part_weight_fraction,
   max_part_weight_fraction,
@@ -240,6 +255,28 @@ static std::ostream& operator<< (std::ostream& os, const Mode& mode) {
   return os << static_cast<uint8_t>(mode);
 }
 
+static std::ostream& operator<< (std::ostream& os, const InputFormat& format) {
+  switch (format) {
+    case InputFormat::automatic: return os << "auto";
+    case InputFormat::hmetis: return os << "hmetis";
+    case InputFormat::binary: return os << "binary";
+    case InputFormat::matrix_market: return os << "mtx";
+    case InputFormat::patoh: return os << "patoh";
+      // omit default case to trigger compiler warning for missing cases
+  }
+  return os << static_cast<uint8_t>(format);
+}
+
+static std::ostream& operator<< (std::ostream& os, const MatrixModel& model) {
+  switch (model) {
+    case MatrixModel::row_net: return os << "row_net";
+    case MatrixModel::column_net: return os << "column_net";
+    case MatrixModel::fine_grain: return os << "fine_grain";
+      // omit default case to trigger compiler warning for missing cases
+  }
+  return os << static_cast<uint8_t>(model);
+}
+
 static std::ostream& operator<< (std::ostream& os, const ContextType& type) {
   if (type == ContextType::main) {
     return os << "main";
@@ -325,6 +362,7 @@ static std::ostream& operator<< (std::ostream& os, const CoarseningAlgorithm& al
     case CoarseningAlgorithm::heavy_full: return os << "heavy_full";
     case CoarseningAlgorithm::heavy_lazy: return os << "heavy_lazy";
     case CoarseningAlgorithm::ml_style: return os << "ml_style";
+    case CoarseningAlgorithm::parallel_ml_style: return os << "parallel_ml_style";
     case CoarseningAlgorithm::do_nothing: return os << "do_nothing";
     case CoarseningAlgorithm::UNDEFINED: return os << "UNDEFINED";
       // omit default case to trigger compiler warning for missing cases
@@ -520,6 +558,8 @@ static CoarseningAlgorithm coarseningAlgorithmFromString(const std::string& type
     return CoarseningAlgorithm::heavy_lazy;
   } else if (type == "ml_style") {
     return CoarseningAlgorithm::ml_style;
+  } else if (type == "parallel_ml_style") {
+    return CoarseningAlgorithm::parallel_ml_style;
   } else if (type == "do_nothing") {
     return CoarseningAlgorithm::do_nothing;
   }
@@ -645,4 +685,34 @@ static BinPackingAlgorithm binPackingAlgorithmFromString(const std::string& type
   exit(0);
   return BinPackingAlgorithm::worst_fit;
 }
+
+static InputFormat inputFormatFromString(const std::string& format) {
+  if (format == "auto") {
+    return InputFormat::automatic;
+  } else if (format == "hmetis") {
+    return InputFormat::hmetis;
+  } else if (format == "binary") {
+    return InputFormat::binary;
+  } else if (format == "mtx") {
+    return InputFormat::matrix_market;
+  } else if (format == "patoh") {
+    return InputFormat::patoh;
+  }
+  LOG << "Illegal option:" << format;
+  exit(0);
+  return InputFormat::automatic;
+}
+
+static MatrixModel matrixModelFromString(const std::string& model) {
+  if (model == "row_net") {
+    return MatrixModel::row_net;
+  } else if (model == "column_net") {
+    return MatrixModel::column_net;
+  } else if (model == "fine_grain") {
+    return MatrixModel::fine_grain;
+  }
+  LOG << "Illegal option:" << model;
+  exit(0);
+  return MatrixModel::row_net;
+}
 }  // namespace kahypar
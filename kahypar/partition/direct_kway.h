@@ -49,6 +49,8 @@ static inline bool partitionVCycle(Hypergraph& hypergraph, ICoarsener& coarsener
   HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
   Timer::instance().add(context, Timepoint::v_cycle_coarsening,
                         std::chrono::duration<double>(end - start).count());
+  multilevel::trackMemoryConsumption(hypergraph, coarsener, nullptr, context,
+                                     Timepoint::v_cycle_coarsening);
 
   if (context.partition.verbose_output && context.type == ContextType::main) {
     io::printHypergraphInfo(hypergraph, "Coarsened Hypergraph");
@@ -63,6 +65,8 @@ static inline bool partitionVCycle(Hypergraph& hypergraph, ICoarsener& coarsener
   end = std::chrono::high_resolution_clock::now();
   Timer::instance().add(context, Timepoint::v_cycle_local_search,
                         std::chrono::duration<double>(end - start).count());
+  multilevel::trackMemoryConsumption(hypergraph, coarsener, &refiner, context,
+                                     Timepoint::v_cycle_local_search);
 
   io::printLocalSearchResults(context, hypergraph);
   return improved_quality;
@@ -23,6 +23,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <utility>
 #include <vector>
 
 #include "gtest/gtest_prod.h"
@@ -35,6 +36,7 @@
 #include "kahypar/partition/evolutionary/mutate.h"
 #include "kahypar/partition/evolutionary/population.h"
 #include "kahypar/partition/evolutionary/probability_tables.h"
+#include "kahypar/utils/memory_tracker.h"
 
 
 namespace kahypar {
@@ -79,6 +81,7 @@ class EvoPartitioner {
           LOG << "Error in evo_partitioner.h: Non-covered case in decision making";
           std::exit(EXIT_FAILURE);
       }
+      trackMemoryConsumption(hg, context);
     }
     hg.reset();
     hg.setPartition(_population.individualAt(_population.best()).partition());
@@ -127,6 +130,14 @@ class EvoPartitioner {
       verbose(context, 0);
       DBG << _population;
     }
+    trackMemoryConsumption(hg, context);
+  }
+
+  inline void trackMemoryConsumption(const Hypergraph& hg, const Context& context) const {
+    MemoryTreeNode memory("Evolutionary Partitioner");
+    hg.memoryConsumption(&memory);
+    _population.memoryConsumption(&memory);
+    MemoryTracker::instance().update(context, Timepoint::evolutionary, std::move(memory));
   }
 
 
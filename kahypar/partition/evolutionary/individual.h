@@ -101,6 +101,12 @@ class Individual {
     ASSERT(!_strong_cut_edges.empty());
     return _strong_cut_edges;
   }
+
+  // ! Number of bytes allocated for the partition and the cut edge sets
+  inline size_t memoryConsumption() const {
+    return _partition.capacity() * sizeof(PartitionID) +
+           (_cut_edges.capacity() + _strong_cut_edges.capacity()) * sizeof(HyperedgeID);
+  }
   inline void print() const {
     LOG << "Fitness:" << _fitness;
   }
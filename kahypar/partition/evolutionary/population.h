@@ -28,6 +28,7 @@
 #include "kahypar/partition/evolutionary/individual.h"
 #include "kahypar/partition/metrics.h"
 #include "kahypar/partition/partitioner.h"
+#include "kahypar/utils/memory_tree.h"
 #include "kahypar/utils/randomize.h"
 
 namespace kahypar {
@@ -229,6 +230,14 @@ class Population {
     return output_diff.size();
   }
 
+  inline void memoryConsumption(MemoryTreeNode* parent) const {
+    MemoryTreeNode* population_node = parent->addChild("Population",
+                                                       _individuals.capacity() * sizeof(Individual));
+    for (const Individual& individual : _individuals) {
+      population_node->addSize(individual.memoryConsumption());
+    }
+  }
+
  private:
   inline size_t replaceDiverse(Individual&& individual, const bool strong_set) {
     size_t max_similarity = std::numeric_limits<size_t>::max();
@@ -21,15 +21,18 @@
 #pragma once
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "kahypar/definitions.h"
 #include "kahypar/io/hypergraph_io.h"
+#include "kahypar/partition/coarsening/coarsening_cache.h"
 #include "kahypar/partition/coarsening/i_coarsener.h"
 #include "kahypar/partition/context.h"
 #include "kahypar/partition/initial_partition.h"
 #include "kahypar/partition/metrics.h"
 #include "kahypar/partition/refinement/i_refiner.h"
+#include "kahypar/utils/memory_tracker.h"
 #include "kahypar/utils/timer.h"
 
 namespace kahypar {
@@ -38,6 +41,20 @@ using bin_packing::BalancingLevel;
 
 static constexpr bool debug = false;
 
+static inline void trackMemoryConsumption(const Hypergraph& hypergraph,
+                                          const ICoarsener& coarsener,
+                                          const IRefiner* refiner,
+                                          const Context& context,
+                                          const Timepoint& timepoint) {
+  MemoryTreeNode memory("Multilevel Partitioner");
+  hypergraph.memoryConsumption(&memory);
+  coarsener.memoryConsumption(&memory);
+  if (refiner != nullptr) {
+    refiner->memoryConsumption(&memory);
+  }
+  MemoryTracker::instance().update(context, timepoint, std::move(memory));
+}
+
 static inline void partition(Hypergraph& hypergraph,
                              ICoarsener& coarsener,
                              IRefiner& refiner,
@@ -45,10 +62,15 @@ static inline void partition(Hypergraph& hypergraph,
   io::printCoarseningBanner(context);
 
   HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
-  coarsener.coarsen(context.coarsening.contraction_limit);
+  if (coarsening_cache::isApplicable(context)) {
+    coarsening_cache::coarsen(hypergraph, coarsener, context);
+  } else {
+    coarsener.coarsen(context.coarsening.contraction_limit);
+  }
   HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
   Timer::instance().add(context, Timepoint::coarsening,
                         std::chrono::duration<double>(end - start).count());
+  trackMemoryConsumption(hypergraph, coarsener, nullptr, context, Timepoint::coarsening);
 
   if (!context.partition.quiet_mode && context.partition.verbose_output && context.type == ContextType::main) {
     io::printHypergraphInfo(hypergraph, "Coarsened Hypergraph");
@@ -65,6 +87,8 @@ static inline void partition(Hypergraph& hypergraph,
     end = std::chrono::high_resolution_clock::now();
     Timer::instance().add(context, Timepoint::initial_partitioning,
                           std::chrono::duration<double>(end - start).count());
+    trackMemoryConsumption(hypergraph, coarsener, nullptr, context,
+                           Timepoint::initial_partitioning);
 
     hypergraph.initializeNumCutHyperedges();
     if (!context.partition.quiet_mode && context.partition.verbose_output && context.type == ContextType::main) {
@@ -124,6 +148,7 @@ static inline void partition(Hypergraph& hypergraph,
 
   Timer::instance().add(context, Timepoint::local_search,
                         std::chrono::duration<double>(end - start).count());
+  trackMemoryConsumption(hypergraph, coarsener, &refiner, context, Timepoint::local_search);
 
   io::printLocalSearchResults(context, hypergraph);
 }
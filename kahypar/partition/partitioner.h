@@ -124,7 +124,11 @@ class Partitioner {
 
   static inline void setupContext(const Hypergraph& hypergraph, Context& context);
 
-  static inline void configurePreprocessing(const Hypergraph& hypergraph, Context& context);
+  static inline io::HypergraphStats inputStats(const Hypergraph& hypergraph,
+                                               const Context& context);
+
+  static inline void configurePreprocessing(const Hypergraph& hypergraph,
+                                            const io::HypergraphStats& stats, Context& context);
 
   inline void sanitize(Hypergraph& hypergraph, const Context& context);
 
@@ -141,7 +145,23 @@ class Partitioner {
   HypergraphDeduplicator _deduplicator;
 };
 
+inline io::HypergraphStats Partitioner::inputStats(const Hypergraph& hypergraph,
+                                                  const Context& context) {
+  // the statistics computed while reading the input are reused if they still
+  // describe the hypergraph
+  if (context.type == ContextType::main && context.partition.input_stats.valid()) {
+    const io::HypergraphStats& stats = context.partition.input_stats.get();
+    if (stats.num_hypernodes == hypergraph.currentNumNodes() &&
+        stats.num_hyperedges == hypergraph.currentNumEdges() &&
+        stats.num_pins == hypergraph.currentNumPins()) {
+      return stats;
+    }
+  }
+  return io::computeHypergraphStats(hypergraph);
+}
+
 inline void Partitioner::configurePreprocessing(const Hypergraph& hypergraph,
+                                                const io::HypergraphStats& stats,
                                                 Context& context) {
   // Don't use sparsification by default
   context.preprocessing.min_hash_sparsifier.is_active = false;
@@ -150,14 +170,7 @@ inline void Partitioner::configurePreprocessing(const Hypergraph& hypergraph,
       context.evolutionary.action.decision() == EvoDecision::normal) {
     if (context.preprocessing.enable_min_hash_sparsifier) {
       // determine whether or not to apply the sparsifier
-      std::vector<HypernodeID> he_sizes;
-      he_sizes.reserve(hypergraph.currentNumEdges());
-      for (const auto& he : hypergraph.edges()) {
-        he_sizes.push_back(hypergraph.edgeSize(he));
-      }
-      std::sort(he_sizes.begin(), he_sizes.end());
-      if (kahypar::math::median(he_sizes) >=
-          context.preprocessing.min_hash_sparsifier.min_median_he_size) {
+      if (stats.he_size.med >= context.preprocessing.min_hash_sparsifier.min_median_he_size) {
         context.preprocessing.min_hash_sparsifier.is_active = true;
       }
     }
@@ -261,10 +274,19 @@ inline void Partitioner::postprocess(Hypergraph& hypergraph, Hypergraph& sparse_
 }
 
 inline void Partitioner::partition(Hypergraph& hypergraph, Context& context) {
-  configurePreprocessing(hypergraph, context);
+  // the statistics are computed once for both the preprocessing decisions and the output
+  const bool print_input_stats = context.type == ContextType::main &&
+                                 !context.partition.quiet_mode &&
+                                 context.partition.verbose_output;
+  const bool decide_sparsification = context.preprocessing.enable_min_hash_sparsifier &&
+                                     (!context.partition_evolutionary ||
+                                      context.evolutionary.action.decision() == EvoDecision::normal);
+  const io::HypergraphStats stats = decide_sparsification || print_input_stats ?
+                                    inputStats(hypergraph, context) : io::HypergraphStats();
+  configurePreprocessing(hypergraph, stats, context);
 
   setupContext(hypergraph, context);
-  io::printInputInformation(context, hypergraph);
+  io::printInputInformation(context, hypergraph, stats);
 
   io::printTopLevelPreprocessingBanner(context);
   if (context.preprocessing.enable_deduplication) {
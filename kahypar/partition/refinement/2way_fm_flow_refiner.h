@@ -77,6 +77,10 @@ class TwoWayFMFlowRefiner final : public IRefiner,
     _is_initialized = true;
   }
 
+  void memoryConsumptionImpl(MemoryTreeNode* parent) const override final {
+    _fm_refiner->memoryConsumption(parent);
+  }
+
   bool refineImpl(std::vector<HypernodeID>& refinement_nodes,
                   const HypernodeWeightArray& max_allowed_part_weights,
                   const UncontractionGainChanges& changes,
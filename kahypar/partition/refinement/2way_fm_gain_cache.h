@@ -140,6 +140,11 @@ class TwoWayFMGainCache {
     _used_delta_entries.clear();
   }
 
+  // ! Number of bytes allocated for the cache elements and the rollback deltas
+  size_t memoryConsumption() const {
+    return _size * sizeof(CacheElement) + _used_delta_entries.capacity() * sizeof(size_t);
+  }
+
   void clear() {
     for (size_t i = 0; i < _size; ++i) {
       _cache[i] = CacheElement();
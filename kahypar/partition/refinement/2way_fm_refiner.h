@@ -156,6 +156,12 @@ class TwoWayFMRefiner final : public IRefiner,
     }
   }
 
+  void memoryConsumptionImpl(MemoryTreeNode* parent) const override final {
+    MemoryTreeNode* refiner_node = parent->addChild("TwoWay FM Refiner");
+    Base::addMemoryConsumption(refiner_node);
+    refiner_node->addChild("Gain Cache", _gain_cache.memoryConsumption());
+  }
+
   void performMovesAndUpdateCacheImpl(const std::vector<Move>& moves,
                                       std::vector<HypernodeID>& refinement_nodes,
                                       const UncontractionGainChanges& uncontraction_changes) override final {
@@ -217,6 +217,10 @@ class TwoWayHyperFlowCutterRefiner final : public IRefiner,
 
     ASSERT(improved == (refinement_result >= RefinementResult::LocalBalanceImproved));
 
+    if (!improved && _context.local_search.algorithm == RefinementAlgorithm::twoway_fm_hyperflow_cutter) {
+      // Otherwise, the snapshot is released by rollback()
+      _hg.releasePartitionSnapshot();
+    }
     return improved;
   }
 
@@ -301,7 +305,6 @@ class TwoWayHyperFlowCutterRefiner final : public IRefiner,
   using IRefiner::_is_initialized;
   using Base::_hg;
   using Base::_context;
-  using Base::_original_part_id;
   using Base::_flow_execution_policy;
 
   bool should_write_snapshot = false;
@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <vector>
 
 #include "kahypar/partition/context.h"
@@ -33,8 +34,7 @@ class FlowRefinerBase {
   FlowRefinerBase(Hypergraph& hypergraph, const Context& context) :
     _hg(hypergraph),
     _context(context),
-    _flow_execution_policy(),
-    _original_part_id(_hg.initialNumNodes(), -1) { }
+    _flow_execution_policy() { }
 
   virtual ~FlowRefinerBase() = default;
 
@@ -46,29 +46,28 @@ class FlowRefinerBase {
 
  protected:
   std::vector<Move> rollback() {
+    std::vector<HypernodeID> moved_hns = _hg.nodesMovedSincePartitionSnapshot();
+    std::sort(moved_hns.begin(), moved_hns.end());
     std::vector<Move> tmp_moves;
-    for (const HypernodeID& hn : _hg.nodes()) {
+    for (const HypernodeID& hn : moved_hns) {
       ASSERT(_hg.partID(hn) != Hypergraph::kInvalidPartition, V(hn));
-      PartitionID from = _original_part_id[hn];
+      PartitionID from = _hg.snapshotPartID(hn);
       PartitionID to = _hg.partID(hn);
       if (from != to) {
         tmp_moves.emplace_back(hn, from, to);
-        _hg.changeNodePart(hn, to, from);
       }
     }
+    _hg.restorePartitionSnapshot();
+    _hg.releasePartitionSnapshot();
     return tmp_moves;
   }
 
   void storeOriginalPartitionIDs() {
-    for (const HypernodeID& hn : _hg.nodes()) {
-      ASSERT(_hg.partID(hn) != Hypergraph::kInvalidPartition, V(hn));
-      _original_part_id[hn] = _hg.partID(hn);
-    }
+    _hg.createPartitionSnapshot();
   }
 
   Hypergraph& _hg;
   const Context& _context;
   FlowExecutionPolicy _flow_execution_policy;
-  std::vector<PartitionID> _original_part_id;
 };
 }  // namespace kahypar
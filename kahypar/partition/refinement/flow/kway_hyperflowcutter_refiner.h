@@ -140,6 +140,10 @@ class KWayHyperFlowCutterRefiner final : public IRefiner,
     if (_hg.currentNumNodes() == _hg.initialNumNodes()) {            // on last level
       _twoway_flow_refiner.reportRunningTime();
     }
+    if (!improvement) {
+      // Otherwise, the snapshot is released by rollback()
+      _hg.releasePartitionSnapshot();
+    }
     // printMetric(true, true);
     return improvement;
   }
@@ -166,7 +170,6 @@ class KWayHyperFlowCutterRefiner final : public IRefiner,
 
   using Base::_hg;
   using Base::_context;
-  using Base::_original_part_id;
   using Base::_flow_execution_policy;
 
   TwoWayHyperFlowCutterRefiner<FlowExecutionPolicy> _twoway_flow_refiner;
@@ -29,6 +29,7 @@
 #include "kahypar/partition/context.h"
 #include "kahypar/partition/refinement/move.h"
 #include "kahypar/partition/refinement/uncontraction_gain_changes.h"
+#include "kahypar/utils/memory_tree.h"
 
 namespace kahypar {
 struct RollbackInfo {
@@ -198,6 +199,13 @@ class FMRefinerBase {
     }
   }
 
+  void addMemoryConsumption(MemoryTreeNode* refiner_node) const {
+    refiner_node->addChild("Priority Queue", _pq.memoryConsumption());
+    refiner_node->addChild("Performed Moves",
+                           _performed_moves.capacity() * sizeof(RollbackElement) +
+                           _hns_to_activate.capacity() * sizeof(HypernodeID));
+  }
+
   void reset() {
     _pq.clear();
     _hg.resetHypernodeState();
@@ -31,6 +31,7 @@
 #include "kahypar/partition/metrics.h"
 #include "kahypar/partition/refinement/move.h"
 #include "kahypar/partition/refinement/uncontraction_gain_changes.h"
+#include "kahypar/utils/memory_tree.h"
 
 namespace kahypar {
 class IRefiner {
@@ -66,6 +67,10 @@ class IRefiner {
     return rollbackImpl();
   }
 
+  void memoryConsumption(MemoryTreeNode* parent) const {
+    memoryConsumptionImpl(parent);
+  }
+
  protected:
   IRefiner() = default;
   bool _is_initialized = false;
@@ -83,5 +88,7 @@ class IRefiner {
                                               const UncontractionGainChanges&) { }
 
   virtual std::vector<Move> rollbackImpl() { return std::vector<Move>(); }
+
+  virtual void memoryConsumptionImpl(MemoryTreeNode*) const { }
 };
 }  // namespace kahypar
@@ -206,6 +206,18 @@ class KwayGainCache {
     return *cacheElement(hn);
   }
 
+  // ! Number of bytes allocated for the cache elements and the rollback deltas
+  size_t memoryConsumption() const {
+    size_t size = _num_hns * sizeof(KFMCacheElement*) +
+                  _deltas.capacity() * sizeof(RollbackElement);
+    for (HypernodeID hn = 0; hn < _num_hns; ++hn) {
+      if (_cache[hn] != nullptr) {
+        size += _cache_element_size;
+      }
+    }
+    return size;
+  }
+
   void clear() {
     for (HypernodeID hn = 0; hn < _num_hns; ++hn) {
       if (_cache[hn] != nullptr) {  /// workaround
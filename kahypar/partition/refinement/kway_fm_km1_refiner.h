@@ -112,6 +112,12 @@ class KWayKMinusOneRefiner final : public IRefiner,
     initializeGainCache();
   }
 
+  void memoryConsumptionImpl(MemoryTreeNode* parent) const override final {
+    MemoryTreeNode* refiner_node = parent->addChild("KWay KMinusOne FM Refiner");
+    Base::addMemoryConsumption(refiner_node);
+    refiner_node->addChild("Gain Cache", _gain_cache.memoryConsumption());
+  }
+
   void performMovesAndUpdateCacheImpl(const std::vector<Move>& moves,
                                       std::vector<HypernodeID>& refinement_nodes,
                                       const UncontractionGainChanges& changes) override final {
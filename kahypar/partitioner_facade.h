@@ -63,7 +63,11 @@ class PartitionerFacade {
 
     io::printFinalPartitioningResults(hypergraph, context, elapsed_seconds);
     if (context.partition.write_partition_file) {
-      io::writePartitionFile(hypergraph, context.partition.graph_partition_filename);
+      if (context.partition.write_binary_partition_file) {
+        io::writeBinaryPartitionFile(hypergraph, context.partition.graph_partition_filename);
+      } else {
+        io::writePartitionFile(hypergraph, context.partition.graph_partition_filename);
+      }
     }
 
     if (context.partition.sp_process_output) {
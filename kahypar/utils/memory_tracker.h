@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2018 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <utility>
+
+#include "kahypar/definitions.h"
+#include "kahypar/partition/context.h"
+#include "kahypar/utils/memory_tree.h"
+#include "kahypar/utils/timer.h"
+
+namespace kahypar {
+/*!
+ * Collects the memory consumption of the data structures used in the different
+ * phases of the multilevel algorithm. The consumption is sampled at the end of each
+ * phase and for each Timepoint, we store the largest sample. Phases executed during
+ * initial partitioning are accounted for in the corresponding ip_* Timepoints.
+ * Additionally, the memory tree of the overall largest sample is kept for reporting.
+ *
+ * Note that the samples do not measure the peak memory consumption: Each sample only
+ * covers the data structures of one multilevel run at the end of a phase. In particular,
+ * the samples taken during initial partitioning do not include the input hypergraph and
+ * the contraction history of the enclosing run.
+ */
+class MemoryTracker {
+ public:
+  static MemoryTracker & instance() {
+    static MemoryTracker instance;
+    return instance;
+  }
+
+  void update(const Context& context, const Timepoint& timepoint, MemoryTreeNode&& tree) {
+    const size_t size = tree.size();
+    size_t& max_sample = _max_samples[static_cast<size_t>(phase(context, timepoint))];
+    max_sample = std::max(max_sample, size);
+    if (size > _max_sample) {
+      _max_sample = size;
+      _max_sample_tree = std::make_unique<MemoryTreeNode>(std::move(tree));
+    }
+  }
+
+  // ! Largest memory consumption in bytes sampled at the end of the given phase
+  size_t maxSample(const Timepoint& timepoint) const {
+    return _max_samples[static_cast<size_t>(timepoint)];
+  }
+
+  // ! Largest memory consumption in bytes sampled over all phases
+  size_t maxSample() const {
+    return _max_sample;
+  }
+
+  // ! Memory tree of the overall largest sample or nullptr if nothing was recorded
+  const MemoryTreeNode* maxSampleTree() const {
+    return _max_sample_tree.get();
+  }
+
+  void clear() {
+    _max_samples.fill(0);
+    _max_sample = 0;
+    _max_sample_tree.reset();
+  }
+
+ private:
+  MemoryTracker() :
+    _max_samples(),
+    _max_sample(0),
+    _max_sample_tree() {
+    _max_samples.fill(0);
+  }
+
+  static Timepoint phase(const Context& context, const Timepoint& timepoint) {
+    if (context.type == ContextType::initial_partitioning) {
+      switch (timepoint) {
+        case Timepoint::coarsening:
+          return Timepoint::ip_coarsening;
+        case Timepoint::initial_partitioning:
+          return Timepoint::ip_initial_partitioning;
+        case Timepoint::local_search:
+          return Timepoint::ip_local_search;
+        default:
+          break;
+      }
+    }
+    return timepoint;
+  }
+
+  std::array<size_t, static_cast<size_t>(Timepoint::COUNT)> _max_samples;
+  size_t _max_sample;
+  std::unique_ptr<MemoryTreeNode> _max_sample_tree;
+};
+}  // namespace kahypar
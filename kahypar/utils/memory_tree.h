@@ -0,0 +1,119 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2018 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <iomanip>
+#include <ios>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace kahypar {
+/*!
+ * Hierarchical breakdown of the memory consumption of a data structure.
+ * Each node stores the number of bytes used by the data structure itself and
+ * the memory consumption of its components as children.
+ */
+class MemoryTreeNode {
+ public:
+  explicit MemoryTreeNode(std::string name, const size_t size_in_bytes = 0) :
+    _name(std::move(name)),
+    _size_in_bytes(size_in_bytes),
+    _children() { }
+
+  MemoryTreeNode(const MemoryTreeNode&) = delete;
+  MemoryTreeNode& operator= (const MemoryTreeNode&) = delete;
+
+  MemoryTreeNode(MemoryTreeNode&&) = default;
+  MemoryTreeNode& operator= (MemoryTreeNode&&) = default;
+
+  ~MemoryTreeNode() = default;
+
+  MemoryTreeNode* addChild(std::string name, const size_t size_in_bytes = 0) {
+    _children.emplace_back(std::make_unique<MemoryTreeNode>(std::move(name), size_in_bytes));
+    return _children.back().get();
+  }
+
+  void addSize(const size_t size_in_bytes) {
+    _size_in_bytes += size_in_bytes;
+  }
+
+  // ! Returns the memory consumption of this node including all its children
+  size_t size() const {
+    size_t size = _size_in_bytes;
+    for (const auto& child : _children) {
+      size += child->size();
+    }
+    return size;
+  }
+
+  const std::string & name() const {
+    return _name;
+  }
+
+  const std::vector<std::unique_ptr<MemoryTreeNode> >& children() const {
+    return _children;
+  }
+
+  // ! Returns the first child with the given name or nullptr if there is none
+  const MemoryTreeNode* child(const std::string& name) const {
+    for (const auto& child : _children) {
+      if (child->name() == name) {
+        return child.get();
+      }
+    }
+    return nullptr;
+  }
+
+  void print(std::ostream& os) const {
+    const std::ios_base::fmtflags flags = os.flags();
+    const std::streamsize precision = os.precision();
+    os << std::fixed << std::setprecision(3);
+    printNode(os, 0);
+    os.flags(flags);
+    os.precision(precision);
+  }
+
+  static double toMegaBytes(const size_t size_in_bytes) {
+    return static_cast<double>(size_in_bytes) / (1024.0 * 1024.0);
+  }
+
+ private:
+  void printNode(std::ostream& os, const size_t depth) const {
+    os << std::string(2 * depth, ' ') << "+ " << _name << " = "
+       << toMegaBytes(size()) << " MB" << std::endl;
+    for (const auto& child : _children) {
+      child->printNode(os, depth + 1);
+    }
+  }
+
+  std::string _name;
+  size_t _size_in_bytes;
+  std::vector<std::unique_ptr<MemoryTreeNode> > _children;
+};
+
+inline std::ostream& operator<< (std::ostream& os, const MemoryTreeNode& node) {
+  node.print(os);
+  return os;
+}
+}  // namespace kahypar
@@ -0,0 +1,55 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2018 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace kahypar {
+namespace utils {
+// ! Number of threads to process size units of work, if each thread should get at least min_size units
+static inline size_t numThreads(const size_t size, const size_t min_size) {
+  return std::max(static_cast<size_t>(1),
+                  std::min(static_cast<size_t>(std::thread::hardware_concurrency()),
+                           size / min_size));
+}
+
+// ! Calls f for each element in a separate thread. The first element is processed by the caller.
+template <typename T, typename F>
+static inline void parallelForEach(std::vector<T>& elements, const F& f) {
+  if (elements.empty()) {
+    return;
+  }
+  std::vector<std::thread> threads;
+  threads.reserve(elements.size() - 1);
+  for (size_t i = 1; i < elements.size(); ++i) {
+    threads.emplace_back([&elements, &f, i]() {
+        f(elements[i]);
+      });
+  }
+  f(elements[0]);
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+}
+}  // namespace utils
+}  // namespace kahypar
@@ -28,6 +28,7 @@
 
 namespace kahypar {
 enum class Timepoint : uint8_t {
+  read_hypergraph,
   pre_sparsifier,
   pre_community_detection,
   coarsening,
@@ -82,6 +83,7 @@ class Timer {
 
 
   struct Result {
+    double read_hypergraph = 0.0;
     double pre_sparsifier = 0.0;
     double pre_community_detection = 0.0;
     double total_preprocessing = 0.0;
@@ -161,6 +163,9 @@ class Timer {
 
       if (timing.type == ContextType::main) {
         switch (timing.timepoint) {
+          case Timepoint::read_hypergraph:
+            _result.read_hypergraph = timing.time;
+            break;
           case Timepoint::pre_sparsifier:
             _result.pre_sparsifier = timing.time;
             break;
@@ -27,6 +27,14 @@
 #include "kahypar/partitioner_facade.h"
 #include "kahypar/utils/randomize.h"
 
+static_assert(sizeof(kahypar_hypernode_id_t) == sizeof(kahypar::HypernodeID),
+              "kahypar_hypernode_id_t does not match kahypar::HypernodeID");
+static_assert(sizeof(kahypar_hyperedge_id_t) == sizeof(kahypar::HyperedgeID),
+              "kahypar_hyperedge_id_t does not match kahypar::HyperedgeID");
+static_assert(sizeof(kahypar_hypernode_weight_t) == sizeof(kahypar::HypernodeWeight),
+              "kahypar_hypernode_weight_t does not match kahypar::HypernodeWeight");
+static_assert(sizeof(kahypar_hyperedge_weight_t) == sizeof(kahypar::HyperedgeWeight),
+              "kahypar_hyperedge_weight_t does not match kahypar::HyperedgeWeight");
 
 kahypar_context_t* kahypar_context_new() {
   return reinterpret_cast<kahypar_context_t*>(new kahypar::Context());
@@ -77,16 +85,8 @@ void kahypar_set_fixed_vertices(kahypar_hypergraph_t* kahypar_hypergraph,
 }
 
 kahypar_hypergraph_t* kahypar_create_hypergraph_from_file(const char* file_name, const kahypar_partition_id_t num_blocks) {
-  kahypar::HypernodeID num_hypernodes;
-  kahypar::HyperedgeID num_hyperedges;
-  kahypar::HyperedgeIndexVector index_vector;
-  kahypar::HyperedgeVector edge_vector;
-  kahypar::HypernodeWeightVector hypernode_weights;
-  kahypar::HyperedgeWeightVector hyperedge_weights;
-  kahypar::io::readHypergraphFile(file_name, num_hypernodes, num_hyperedges,
-                                  index_vector, edge_vector, &hyperedge_weights, &hypernode_weights);
-  return reinterpret_cast<kahypar_hypergraph_t*>(new kahypar::Hypergraph(num_hypernodes, num_hyperedges, index_vector, edge_vector,
-                                                                         num_blocks, &hyperedge_weights, &hypernode_weights));
+  return reinterpret_cast<kahypar_hypergraph_t*>(
+    new kahypar::Hypergraph(kahypar::io::createHypergraphFromFile(file_name, num_blocks)));
 }
 
 KAHYPAR_API kahypar_hypergraph_t* kahypar_create_hypergraph(const kahypar_partition_id_t num_blocks,
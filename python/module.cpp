@@ -138,7 +138,7 @@ If only one type of weights is required, the other argument has to be an empty l
       .def("connectivity", &Hypergraph::connectivity,
            "Get the connecivity of the hyperedge (i.e., the number of blocks which contain at least one pin)",
            py::arg("hyperedge"))
-      .def("connectivitySet", &Hypergraph::connectivitySet, py::return_value_policy::reference_internal,
+      .def("connectivitySet", &Hypergraph::connectivitySet, py::keep_alive<0, 1>(),
            "Get the connectivity set of the hyperedge",
            py::arg("hyperedge"))
       .def("communities", &Hypergraph::communities,
@@ -189,8 +189,10 @@ If only one type of weights is required, the other argument has to be an empty l
            "Iterate over all blocks contained in the connectivity set of the hyperedge");
 
   m.def(
-      "createHypergraphFromFile", &kahypar::io::createHypergraphFromFile,
-      "Construct a hypergraph from a file in hMETIS format",
+      "createHypergraphFromFile",
+      static_cast<kahypar::Hypergraph (*)(const std::string&, const kahypar::PartitionID)>(
+        &kahypar::io::createHypergraphFromFile),
+      "Construct a hypergraph from a file in hMETIS, KaHyPar binary, MatrixMarket or PaToH format",
       py::arg("filename"), py::arg("k"));
 
 
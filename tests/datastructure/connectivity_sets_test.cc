@@ -0,0 +1,106 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2018 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+******************************************************************************/
+
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "kahypar/datastructure/connectivity_sets.h"
+#include "kahypar/definitions.h"
+
+using ::testing::Eq;
+using ::testing::ElementsAre;
+using ::testing::Test;
+
+namespace kahypar {
+namespace ds {
+class AConnectivitySets : public Test {
+ public:
+  AConnectivitySets() :
+    sets() {
+    // hyperedge 1 can connect at most two blocks
+    const std::vector<HypernodeID> edge_sizes = { 5, 2, 8 };
+    sets.initialize(3, 4, [&](const HyperedgeID he) {
+        return edge_sizes[he];
+      });
+  }
+
+  std::vector<PartitionID> blocksOf(const HyperedgeID he) const {
+    return std::vector<PartitionID>(sets[he].begin(), sets[he].end());
+  }
+
+  ConnectivitySets<PartitionID, HyperedgeID> sets;
+};
+
+TEST_F(AConnectivitySets, AreInitiallyEmpty) {
+  for (HyperedgeID he = 0; he < 3; ++he) {
+    ASSERT_THAT(sets[he].size(), Eq(0));
+    for (PartitionID part = 0; part < 4; ++part) {
+      ASSERT_THAT(sets[he].contains(part), Eq(false));
+    }
+  }
+}
+
+TEST_F(AConnectivitySets, StoreBlocksInInsertionOrder) {
+  sets.add(0, 3);
+  sets.add(0, 0);
+  sets.add(0, 2);
+  sets.add(1, 2);
+  sets.add(1, 1);
+
+  ASSERT_THAT(blocksOf(0), ElementsAre(3, 0, 2));
+  ASSERT_THAT(blocksOf(1), ElementsAre(2, 1));
+  ASSERT_THAT(sets[2].size(), Eq(0));
+  ASSERT_THAT(sets.contains(0, 2), Eq(true));
+  ASSERT_THAT(sets.contains(0, 1), Eq(false));
+  ASSERT_THAT(sets[1].contains(1), Eq(true));
+}
+
+TEST_F(AConnectivitySets, ReplaceRemovedBlockWithLastBlock) {
+  sets.add(2, 0);
+  sets.add(2, 1);
+  sets.add(2, 2);
+  sets.add(2, 3);
+  sets.remove(2, 1);
+
+  ASSERT_THAT(blocksOf(2), ElementsAre(0, 3, 2));
+  ASSERT_THAT(sets.contains(2, 1), Eq(false));
+
+  sets.remove(2, 2);
+  sets.add(2, 1);
+  ASSERT_THAT(blocksOf(2), ElementsAre(0, 3, 1));
+}
+
+TEST_F(AConnectivitySets, CanBeClearedIndividually) {
+  sets.add(0, 1);
+  sets.add(0, 2);
+  sets.add(1, 2);
+  sets.clear(0);
+
+  ASSERT_THAT(sets[0].size(), Eq(0));
+  ASSERT_THAT(sets.contains(0, 1), Eq(false));
+  ASSERT_THAT(sets.contains(0, 2), Eq(false));
+  ASSERT_THAT(blocksOf(1), ElementsAre(2));
+
+  sets.add(0, 2);
+  ASSERT_THAT(blocksOf(0), ElementsAre(2));
+}
+}  // namespace ds
+}  // namespace kahypar
@@ -20,6 +20,7 @@
 
 #include <iostream>
 #include <stack>
+#include <thread>
 #include <tuple>
 
 #include "gmock/gmock.h"
@@ -30,6 +31,7 @@
 #include "tests/datastructure/hypergraph_test_fixtures.h"
 
 using ::testing::Eq;
+using ::testing::Ge;
 using ::testing::ContainerEq;
 using ::testing::Test;
 
@@ -129,13 +131,13 @@ TEST_F(AHypergraph, DecrementsNumberOfPinsOnHyperedgeRemoval) {
 }
 
 TEST_F(AHypergraph, DecrementsHypernodeDegreeOfAffectedHypernodesOnHyperedgeRemoval) {
-  ASSERT_THAT(hypergraph.hypernode(3).size(), Eq(2));
-  ASSERT_THAT(hypergraph.hypernode(4).size(), Eq(2));
-  ASSERT_THAT(hypergraph.hypernode(6).size(), Eq(2));
+  ASSERT_THAT(hypergraph.nodeDegree(3), Eq(2));
+  ASSERT_THAT(hypergraph.nodeDegree(4), Eq(2));
+  ASSERT_THAT(hypergraph.nodeDegree(6), Eq(2));
   hypergraph.removeEdge(2);
-  ASSERT_THAT(hypergraph.hypernode(3).size(), Eq(1));
-  ASSERT_THAT(hypergraph.hypernode(4).size(), Eq(1));
-  ASSERT_THAT(hypergraph.hypernode(6).size(), Eq(1));
+  ASSERT_THAT(hypergraph.nodeDegree(3), Eq(1));
+  ASSERT_THAT(hypergraph.nodeDegree(4), Eq(1));
+  ASSERT_THAT(hypergraph.nodeDegree(6), Eq(1));
 }
 
 TEST_F(AHypergraph, InvalidatesContractedHypernode) {
@@ -393,6 +395,75 @@ TEST_F(AnUncontractionOperation, UpdatesPartitionIndexOfUncontractedNode) {
   ASSERT_THAT(hypergraph.partID(2), Eq(1));
 }
 
+#ifndef KAHYPAR_USE_COMPACT_HYPERGRAPH
+TEST_F(AnUncontractedHypergraph, EqualsTheInitialHypergraphAfterUncontractingConcurrentContractions) {
+  const std::vector<std::pair<HypernodeID, HypernodeID> > pairs = { { 0, 2 }, { 3, 4 }, { 5, 6 } };
+  std::vector<size_t> contraction_order(pairs.size());
+
+  modified_hypergraph.beginConcurrentContractions();
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < pairs.size(); ++i) {
+    threads.emplace_back([&, i]() {
+        const auto contraction = modified_hypergraph.contractConcurrently(pairs[i].first,
+                                                                          pairs[i].second);
+        contraction_order[contraction.second] = i;
+      });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  modified_hypergraph.endConcurrentContractions();
+
+  ASSERT_THAT(modified_hypergraph.currentNumNodes(), Eq(4));
+  ASSERT_THAT(modified_hypergraph.currentNumPins(), Eq(8));
+
+  Hypergraph sequential_hypergraph(7, 4, HyperedgeIndexVector { 0, 2, 6, 9, /*sentinel*/ 12 },
+                                   HyperedgeVector { 0, 2, 0, 1, 3, 4, 3, 4, 6, 2, 5, 6 });
+  for (const size_t i : contraction_order) {
+    sequential_hypergraph.contract(pairs[i].first, pairs[i].second);
+  }
+  ASSERT_THAT(verifyEquivalenceWithoutPartitionInfo(sequential_hypergraph, modified_hypergraph),
+              Eq(true));
+
+  modified_hypergraph.setNodePart(0, 0);
+  modified_hypergraph.setNodePart(1, 0);
+  modified_hypergraph.setNodePart(3, 1);
+  modified_hypergraph.setNodePart(5, 1);
+  modified_hypergraph.initializeNumCutHyperedges();
+  for (auto it = contraction_order.rbegin(); it != contraction_order.rend(); ++it) {
+    modified_hypergraph.uncontract(Memento { pairs[*it].first, pairs[*it].second });
+  }
+
+  ASSERT_THAT(modified_hypergraph.currentNumNodes(), Eq(7));
+  ASSERT_THAT(modified_hypergraph.currentNumPins(), Eq(12));
+  ASSERT_THAT(verifyEquivalenceWithoutPartitionInfo(hypergraph, modified_hypergraph), Eq(true));
+}
+
+TEST_F(AnUncontractedHypergraph, SupportsSeveralRoundsOfConcurrentContractions) {
+  modified_hypergraph.beginConcurrentContractions();
+  modified_hypergraph.contractConcurrently(0, 2);
+  modified_hypergraph.contractConcurrently(3, 4);
+  modified_hypergraph.endConcurrentContractions();
+  ASSERT_THAT(modified_hypergraph.currentNumNodes(), Eq(5));
+
+  modified_hypergraph.beginConcurrentContractions();
+  ASSERT_THAT(modified_hypergraph.contractConcurrently(5, 6).second, Eq(0));
+  modified_hypergraph.endConcurrentContractions();
+  ASSERT_THAT(modified_hypergraph.currentNumNodes(), Eq(4));
+  ASSERT_THAT(modified_hypergraph.currentNumPins(), Eq(8));
+
+  modified_hypergraph.setNodePart(0, 0);
+  modified_hypergraph.setNodePart(1, 0);
+  modified_hypergraph.setNodePart(3, 1);
+  modified_hypergraph.setNodePart(5, 1);
+  modified_hypergraph.initializeNumCutHyperedges();
+  modified_hypergraph.uncontract(Memento { 5, 6 });
+  modified_hypergraph.uncontract(Memento { 3, 4 });
+  modified_hypergraph.uncontract(Memento { 0, 2 });
+  ASSERT_THAT(verifyEquivalenceWithoutPartitionInfo(hypergraph, modified_hypergraph), Eq(true));
+}
+#endif
+
 TEST(AnUnconnectedHypernode, IsNotRemovedTogetherWithLastEdgeIfFlagIsFalse) {
   Hypergraph hypergraph(1, 1, HyperedgeIndexVector { 0,  /*sentinel*/ 1 },
                         HyperedgeVector { 0 });
@@ -457,7 +528,7 @@ TEST_F(AHypergraph, InvalidatesPartitionPinCountsOnHyperedgeRemoval) {
 
   for (PartitionID part = 0; part < hypergraph._k; ++part) {
     // bypass pinCountInPart because of assertions
-    const HypernodeID num_pins = hypergraph._pins_in_part[1 * hypergraph._k + part];
+    const HypernodeID num_pins = hypergraph._pins_in_part.get(1, part);
     ASSERT_THAT(num_pins, Eq(hypergraph.kInvalidCount));
   }
 }
@@ -812,6 +883,77 @@ TEST_F(APartitionedHypergraph, CanBeResetToUnpartitionedState) {
 }
 
 
+TEST_F(APartitionedHypergraph, RecordsHypernodesMovedSinceThePartitionSnapshot) {
+  hypergraph.initializeNumCutHyperedges();
+  hypergraph.createPartitionSnapshot();
+  hypergraph.changeNodePart(1, 0, 1);
+  hypergraph.changeNodePart(2, 1, 0);
+  hypergraph.changeNodePart(1, 1, 0);
+  hypergraph.changeNodePart(5, 1, 0);
+
+  ASSERT_THAT(hypergraph.nodesMovedSincePartitionSnapshot(),
+              ContainerEq(std::vector<HypernodeID>{ 1, 2, 5 }));
+  ASSERT_THAT(hypergraph.snapshotPartID(1), Eq(0));
+  ASSERT_THAT(hypergraph.snapshotPartID(2), Eq(1));
+  ASSERT_THAT(hypergraph.snapshotPartID(5), Eq(1));
+  ASSERT_THAT(hypergraph.snapshotPartID(6), Eq(1));
+}
+
+TEST_F(APartitionedHypergraph, CanBeRestoredToThePartitionSnapshot) {
+  hypergraph.initializeNumCutHyperedges();
+  original_hypergraph.setNodePart(0, 0);
+  original_hypergraph.setNodePart(1, 0);
+  original_hypergraph.setNodePart(2, 1);
+  original_hypergraph.setNodePart(3, 0);
+  original_hypergraph.setNodePart(4, 0);
+  original_hypergraph.setNodePart(5, 1);
+  original_hypergraph.setNodePart(6, 1);
+  original_hypergraph.initializeNumCutHyperedges();
+
+  hypergraph.createPartitionSnapshot();
+  hypergraph.changeNodePart(0, 0, 1);
+  hypergraph.changeNodePart(6, 1, 0);
+  hypergraph.changeNodePart(2, 1, 0);
+  hypergraph.restorePartitionSnapshot();
+
+  ASSERT_THAT(hypergraph.nodesMovedSincePartitionSnapshot().empty(), Eq(true));
+  ASSERT_THAT(verifyEquivalenceWithPartitionInfo(hypergraph, original_hypergraph), Eq(true));
+
+  // The snapshot remains valid after restoring it
+  hypergraph.changeNodePart(3, 0, 1);
+  hypergraph.restorePartitionSnapshot();
+  ASSERT_THAT(verifyEquivalenceWithPartitionInfo(hypergraph, original_hypergraph), Eq(true));
+
+  hypergraph.releasePartitionSnapshot();
+  hypergraph.changeNodePart(3, 0, 1);
+  ASSERT_THAT(hypergraph.partID(3), Eq(1));
+}
+
+using APartitionedHypergraphDeathTest = APartitionedHypergraph;
+
+TEST_F(APartitionedHypergraphDeathTest, CannotBeContractedWhileAPartitionSnapshotIsActive) {
+  hypergraph.createPartitionSnapshot();
+  ASSERT_DEBUG_DEATH(hypergraph.contract(0, 2), ".*");
+}
+
+TEST_F(AHypergraph, ReportsTheMemoryConsumptionOfItsDataStructures) {
+  MemoryTreeNode root("Root");
+  hypergraph.memoryConsumption(&root);
+
+  ASSERT_THAT(root.children().size(), Eq(1));
+  const MemoryTreeNode& hypergraph_node = *root.children()[0];
+  ASSERT_THAT(hypergraph_node.name(), Eq("Hypergraph"));
+  ASSERT_THAT(hypergraph_node.size(), Eq(root.size()));
+  size_t children_size = 0;
+  for (const auto& child : hypergraph_node.children()) {
+    children_size += child->size();
+  }
+  ASSERT_THAT(hypergraph_node.size(), Eq(children_size));
+  ASSERT_THAT(hypergraph_node.children()[2]->name(), Eq("Incidence Array"));
+  ASSERT_THAT(hypergraph_node.children()[2]->size(),
+              Ge(hypergraph.initialNumPins() * sizeof(HypernodeID)));
+}
+
 TEST_F(APartitionedHypergraph, IdentifiesBorderHypernodes) {
   hypergraph.initializeNumCutHyperedges();
   ASSERT_THAT(hypergraph.isBorderNode(0), Eq(true));
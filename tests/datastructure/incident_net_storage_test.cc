@@ -0,0 +1,200 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2018 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+******************************************************************************/
+
+#include <stack>
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "kahypar/datastructure/hypergraph.h"
+#include "kahypar/datastructure/incident_net_storage.h"
+#include "kahypar/definitions.h"
+
+using ::testing::Eq;
+using ::testing::ElementsAre;
+using ::testing::Le;
+using ::testing::Lt;
+using ::testing::Test;
+
+namespace kahypar {
+namespace ds {
+using IncidentNets = IncidentNetArray<HypernodeID, HyperedgeID>;
+using CompactHypergraph = GenericHypergraph<HypernodeID, HyperedgeID, HypernodeWeight,
+                                            HyperedgeWeight, PartitionID,
+                                            meta::Empty, meta::Empty, IncidentNets>;
+
+class AnIncidentNetArray : public Test {
+ public:
+  AnIncidentNetArray() :
+    incident_nets() {
+    incident_nets.initialize({ 2, 1, 2 });
+    incident_nets[0].push_back(0);
+    incident_nets[0].push_back(1);
+    incident_nets[1].push_back(1);
+    incident_nets[2].push_back(0);
+    incident_nets[2].push_back(2);
+  }
+
+  std::vector<HyperedgeID> netsOf(const HypernodeID hn) const {
+    return std::vector<HyperedgeID>(incident_nets.cbegin(hn), incident_nets.cend(hn));
+  }
+
+  IncidentNets incident_nets;
+};
+
+TEST_F(AnIncidentNetArray, StoresIncidentNetsOfAllHypernodes) {
+  ASSERT_THAT(incident_nets.size(0), Eq(2));
+  ASSERT_THAT(incident_nets.size(1), Eq(1));
+  ASSERT_THAT(incident_nets.size(2), Eq(2));
+  ASSERT_THAT(netsOf(0), ElementsAre(0, 1));
+  ASSERT_THAT(netsOf(1), ElementsAre(1));
+  ASSERT_THAT(netsOf(2), ElementsAre(0, 2));
+}
+
+TEST_F(AnIncidentNetArray, MovesSlotToTheEndIfCapacityIsExceeded) {
+  incident_nets[0].push_back(2);
+  incident_nets[0].push_back(3);
+  ASSERT_THAT(netsOf(0), ElementsAre(0, 1, 2, 3));
+  ASSERT_THAT(netsOf(1), ElementsAre(1));
+  ASSERT_THAT(netsOf(2), ElementsAre(0, 2));
+}
+
+TEST_F(AnIncidentNetArray, ExtendsLastSlotInPlace) {
+  incident_nets[2].push_back(3);
+  ASSERT_THAT(netsOf(2), ElementsAre(0, 2, 3));
+  ASSERT_THAT(netsOf(0), ElementsAre(0, 1));
+}
+
+TEST_F(AnIncidentNetArray, ReusesCapacityAfterPopBack) {
+  incident_nets[1].pop_back();
+  ASSERT_THAT(incident_nets.size(1), Eq(0));
+  incident_nets[1].push_back(2);
+  ASSERT_THAT(netsOf(1), ElementsAre(2));
+  ASSERT_THAT(netsOf(2), ElementsAre(0, 2));
+}
+
+TEST_F(AnIncidentNetArray, ReusesReleasedSlots) {
+  incident_nets[0].push_back(2);
+  ASSERT_THAT(incident_nets.numEntries(), Eq(9));
+  incident_nets[1].push_back(3);
+  ASSERT_THAT(incident_nets.numEntries(), Eq(9));
+  ASSERT_THAT(netsOf(0), ElementsAre(0, 1, 2));
+  ASSERT_THAT(netsOf(1), ElementsAre(1, 3));
+  ASSERT_THAT(netsOf(2), ElementsAre(0, 2));
+}
+
+TEST_F(AnIncidentNetArray, ReleasesUnusedCapacityAfterPopBack) {
+  for (HyperedgeID he = 2; he < 10; ++he) {
+    incident_nets[0].push_back(he);
+  }
+  const size_t num_entries = incident_nets.numEntries();
+  for (HyperedgeID he = 2; he < 10; ++he) {
+    incident_nets[0].pop_back();
+  }
+  ASSERT_THAT(incident_nets.numEntries(), Lt(num_entries));
+  incident_nets[1].push_back(2);
+  incident_nets[1].push_back(3);
+  incident_nets[1].push_back(4);
+  ASSERT_THAT(incident_nets.numEntries(), Le(num_entries));
+  ASSERT_THAT(netsOf(0), ElementsAre(0, 1));
+  ASSERT_THAT(netsOf(1), ElementsAre(1, 2, 3, 4));
+  ASSERT_THAT(netsOf(2), ElementsAre(0, 2));
+}
+
+TEST(AnIncidentNetArrayOfAStar, DoesNotGrowDuringRepeatedContractionsAndUncontractions) {
+  // Each step contracts all other hypernodes into a different representative and
+  // reverts the contractions afterwards, i.e., the representative gains and loses
+  // all nets. Without reusing released slots, each step would append a new slot.
+  const HypernodeID num_hypernodes = 64;
+  IncidentNets incident_nets;
+  incident_nets.initialize(std::vector<HyperedgeID>(num_hypernodes, 1));
+  for (HypernodeID hn = 0; hn < num_hypernodes; ++hn) {
+    incident_nets[hn].push_back(hn);
+  }
+
+  for (int round = 0; round < 4; ++round) {
+    for (HypernodeID rep = 0; rep < num_hypernodes; ++rep) {
+      for (HyperedgeID he = 0; he < num_hypernodes; ++he) {
+        if (he != rep) {
+          incident_nets[rep].push_back(he);
+        }
+      }
+      for (HyperedgeID he = 1; he < num_hypernodes; ++he) {
+        incident_nets[rep].pop_back();
+      }
+      ASSERT_THAT(incident_nets.size(rep), Eq(1));
+      ASSERT_THAT(incident_nets.numEntries(), Le(8 * num_hypernodes));
+    }
+  }
+  for (HypernodeID hn = 0; hn < num_hypernodes; ++hn) {
+    ASSERT_THAT(incident_nets[hn][0], Eq(hn));
+  }
+}
+
+TEST_F(AnIncidentNetArray, SupportsSwapAndPopBackRemoval) {
+  std::swap(incident_nets[0][0], incident_nets[0].back());
+  incident_nets[0].pop_back();
+  ASSERT_THAT(netsOf(0), ElementsAre(1));
+}
+
+class ACompactHypergraph : public Test {
+ public:
+  ACompactHypergraph() :
+    hypergraph(7, 4, HyperedgeIndexVector { 0, 2, 6, 9,  /*sentinel*/ 12 },
+               HyperedgeVector { 0, 2, 0, 1, 3, 4, 3, 4, 6, 2, 5, 6 }),
+    original_hypergraph(7, 4, HyperedgeIndexVector { 0, 2, 6, 9,  /*sentinel*/ 12 },
+                        HyperedgeVector { 0, 2, 0, 1, 3, 4, 3, 4, 6, 2, 5, 6 }) { }
+
+  CompactHypergraph hypergraph;
+  CompactHypergraph original_hypergraph;
+};
+
+TEST_F(ACompactHypergraph, InitializesIncidentNetsOfAllHypernodes) {
+  ASSERT_THAT(hypergraph.nodeDegree(0), Eq(2));
+  ASSERT_THAT(hypergraph.nodeDegree(1), Eq(1));
+  ASSERT_THAT(hypergraph.nodeDegree(2), Eq(2));
+  ASSERT_THAT(hypergraph.nodeDegree(6), Eq(2));
+  std::vector<HyperedgeID> incident_nets;
+  for (const HyperedgeID& he : hypergraph.incidentEdges(6)) {
+    incident_nets.push_back(he);
+  }
+  ASSERT_THAT(incident_nets, ElementsAre(2, 3));
+}
+
+TEST_F(ACompactHypergraph, RestoresOriginalStateAfterContractionsAndUncontractions) {
+  std::stack<CompactHypergraph::ContractionMemento> mementos;
+  mementos.push(hypergraph.contract(4, 6));
+  mementos.push(hypergraph.contract(3, 4));
+  mementos.push(hypergraph.contract(0, 2));
+  mementos.push(hypergraph.contract(0, 5));
+  mementos.push(hypergraph.contract(0, 3));
+  ASSERT_THAT(hypergraph.currentNumNodes(), Eq(2));
+  ASSERT_THAT(hypergraph.nodeDegree(0), Eq(4));
+  hypergraph.setNodePart(0, 0);
+  hypergraph.setNodePart(1, 0);
+
+  while (!mementos.empty()) {
+    hypergraph.uncontract(mementos.top());
+    mementos.pop();
+  }
+  ASSERT_THAT(verifyEquivalenceWithoutPartitionInfo(hypergraph, original_hypergraph), Eq(true));
+}
+}  // namespace ds
+}  // namespace kahypar
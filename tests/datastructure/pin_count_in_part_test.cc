@@ -0,0 +1,102 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2018 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include "kahypar/datastructure/pin_count_in_part.h"
+#include "kahypar/definitions.h"
+
+using ::testing::Eq;
+using ::testing::Test;
+
+namespace kahypar {
+namespace ds {
+using PinCounts = PinCountInPart<HypernodeID, HyperedgeID, PartitionID>;
+
+class APinCountInPart : public Test {
+ public:
+  APinCountInPart() :
+    pin_counts(3, 5, 6) { }
+
+  PinCounts pin_counts;
+};
+
+TEST_F(APinCountInPart, UsesSmallestPowerOfTwoBitsForMaximumValue) {
+  ASSERT_THAT(PinCounts(1, 2, 0).bitsPerCounter(), Eq(1));
+  ASSERT_THAT(PinCounts(1, 2, 1).bitsPerCounter(), Eq(2));
+  ASSERT_THAT(PinCounts(1, 2, 2).bitsPerCounter(), Eq(2));
+  ASSERT_THAT(PinCounts(1, 2, 3).bitsPerCounter(), Eq(4));
+  ASSERT_THAT(PinCounts(1, 2, 14).bitsPerCounter(), Eq(4));
+  ASSERT_THAT(PinCounts(1, 2, 15).bitsPerCounter(), Eq(8));
+  ASSERT_THAT(PinCounts(1, 2, 70000).bitsPerCounter(), Eq(32));
+}
+
+TEST_F(APinCountInPart, IsInitializedWithZeroCounts) {
+  ASSERT_THAT(pin_counts.size(), Eq(15));
+  for (HyperedgeID he = 0; he < 3; ++he) {
+    for (PartitionID part = 0; part < 5; ++part) {
+      ASSERT_THAT(pin_counts.get(he, part), Eq(0));
+    }
+  }
+}
+
+TEST_F(APinCountInPart, IncrementsAndDecrementsCountersIndependently) {
+  for (HypernodeID i = 0; i < 6; ++i) {
+    ASSERT_THAT(pin_counts.increment(1, 3), Eq(i + 1));
+  }
+  ASSERT_THAT(pin_counts.increment(1, 2), Eq(1));
+  ASSERT_THAT(pin_counts.increment(2, 3), Eq(1));
+  ASSERT_THAT(pin_counts.decrement(1, 3), Eq(5));
+
+  ASSERT_THAT(pin_counts.get(1, 3), Eq(5));
+  ASSERT_THAT(pin_counts.get(1, 2), Eq(1));
+  ASSERT_THAT(pin_counts.get(1, 4), Eq(0));
+  ASSERT_THAT(pin_counts.get(2, 3), Eq(1));
+  ASSERT_THAT(pin_counts.get(0, 3), Eq(0));
+}
+
+TEST_F(APinCountInPart, InvalidatesAndResetsAllCountersOfAHyperedge) {
+  pin_counts.set(0, 4, 6);
+  pin_counts.set(1, 0, 2);
+  pin_counts.invalidate(1);
+  for (PartitionID part = 0; part < 5; ++part) {
+    ASSERT_THAT(pin_counts.get(1, part), Eq(PinCounts::kInvalidCount));
+  }
+  ASSERT_THAT(pin_counts.get(0, 4), Eq(6));
+
+  pin_counts.reset(1);
+  for (PartitionID part = 0; part < 5; ++part) {
+    ASSERT_THAT(pin_counts.get(1, part), Eq(0));
+  }
+  ASSERT_THAT(pin_counts.get(0, 4), Eq(6));
+}
+
+TEST_F(APinCountInPart, KeepsMaximumValueWhenChangingNumberOfBlocks) {
+  pin_counts.set(0, 0, 6);
+  pin_counts.resize(3, 64);
+  ASSERT_THAT(pin_counts.size(), Eq(192));
+  ASSERT_THAT(pin_counts.bitsPerCounter(), Eq(4));
+  ASSERT_THAT(pin_counts.get(0, 0), Eq(0));
+  pin_counts.set(2, 63, 6);
+  ASSERT_THAT(pin_counts.get(2, 63), Eq(6));
+  ASSERT_THAT(pin_counts.get(2, 62), Eq(0));
+}
+}  // namespace ds
+}  // namespace kahypar
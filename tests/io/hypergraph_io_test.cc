@@ -18,9 +18,17 @@
  *
  ******************************************************************************/
 
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <future>
+#include <limits>
+#include <random>
+
 #include "gmock/gmock.h"
 
 #include "kahypar/io/hypergraph_io.h"
+#include "kahypar/utils/math.h"
 #include "tests/io/hypergraph_io_test_fixtures.h"
 
 using ::testing::Eq;
@@ -122,6 +130,161 @@ TEST_F(AHypergraphFileWithoutHyperedges, CanBeParsedIntoAHypergraphIfFileContain
   }
 }
 
+TEST_F(AHypergraphFileWithHypernodeAndHyperedgeWeights, IsParsedIdenticallyWhenSplitIntoChunks) {
+  const MemoryMappedFile file(_filename);
+  ASSERT_THAT(file.isOpen(), Eq(true));
+  for (size_t num_chunks = 1; num_chunks <= 16; ++num_chunks) {
+    HyperedgeIndexVector index_vector;
+    HyperedgeVector edge_vector;
+    HypernodeWeightVector hypernode_weights;
+    HyperedgeWeightVector hyperedge_weights;
+    internal::parseHypergraph(file.begin(), file.end(), num_chunks, _num_hypernodes,
+                              _num_hyperedges, index_vector, edge_vector,
+                              &hyperedge_weights, &hypernode_weights);
+
+    ASSERT_THAT(index_vector, ContainerEq(_control_index_vector));
+    ASSERT_THAT(edge_vector, ContainerEq(_control_edge_vector));
+    ASSERT_THAT(hyperedge_weights, ContainerEq(_control_hyperedge_weights));
+    ASSERT_THAT(hypernode_weights, ContainerEq(_control_hypernode_weights));
+  }
+}
+
+TEST(AHypergraphFile, CanContainCommentsAndWindowsLineEndings) {
+  const std::string contents("% comment\r\n4 7 11\r\n2 1 2\r\n% comment\r\n3 1 7 5 6\r\n"
+                             "8 5 6 4\r\n7 2 3 4 \r\n5\r\n1\r\n8\r\n% comment\r\n7\r\n3\r\n9\r\n3");
+  HypernodeID num_hypernodes = 0;
+  HyperedgeID num_hyperedges = 0;
+  HyperedgeIndexVector index_vector;
+  HyperedgeVector edge_vector;
+  HypernodeWeightVector hypernode_weights;
+  HyperedgeWeightVector hyperedge_weights;
+  internal::parseHypergraph(contents.data(), contents.data() + contents.size(), 3,
+                            num_hypernodes, num_hyperedges, index_vector, edge_vector,
+                            &hyperedge_weights, &hypernode_weights);
+
+  ASSERT_THAT(num_hyperedges, Eq(4));
+  ASSERT_THAT(num_hypernodes, Eq(7));
+  ASSERT_THAT(index_vector, ContainerEq(HyperedgeIndexVector { 0, 2, 6, 9, 12 }));
+  ASSERT_THAT(edge_vector, ContainerEq(HyperedgeVector { 0, 1, 0, 6, 4, 5, 4, 5, 3, 1, 2, 3 }));
+  ASSERT_THAT(hyperedge_weights, ContainerEq(HyperedgeWeightVector { 2, 3, 8, 7 }));
+  ASSERT_THAT(hypernode_weights, ContainerEq(HypernodeWeightVector { 5, 1, 8, 7, 3, 9, 3 }));
+}
+
+static void parseHypergraphFromString(const std::string& contents) {
+  HypernodeID num_hypernodes = 0;
+  HyperedgeID num_hyperedges = 0;
+  HyperedgeIndexVector index_vector;
+  HyperedgeVector edge_vector;
+  HypernodeWeightVector hypernode_weights;
+  HyperedgeWeightVector hyperedge_weights;
+  internal::parseHypergraph(contents.data(), contents.data() + contents.size(), 2,
+                            num_hypernodes, num_hyperedges, index_vector, edge_vector,
+                            &hyperedge_weights, &hypernode_weights);
+}
+
+TEST(AHypergraphFileDeathTest, WithPinZeroLeadsToProgramExit) {
+  EXPECT_EXIT(parseHypergraphFromString("2 3\n1 2\n0 3\n"),
+              ::testing::ExitedWithCode(1),
+              "Error: Hyperedge 1 contains an invalid hypernode ID or weight");
+}
+
+TEST(AHypergraphFileDeathTest, WithPinsLargerThanTheNumberOfHypernodesLeadsToProgramExit) {
+  EXPECT_EXIT(parseHypergraphFromString("2 3\n1 4\n2 3\n"),
+              ::testing::ExitedWithCode(1),
+              "Error: Hyperedge 0 contains an invalid hypernode ID or weight");
+}
+
+TEST(AHypergraphFileDeathTest, WithOverflowingPinsLeadsToProgramExit) {
+  EXPECT_EXIT(parseHypergraphFromString("2 3\n1 2\n3 99999999999999999999\n"),
+              ::testing::ExitedWithCode(1),
+              "Error: Hyperedge 1 contains an invalid hypernode ID or weight");
+}
+
+TEST(AHypergraphFileDeathTest, WithInvalidHypernodeWeightsLeadsToProgramExit) {
+  EXPECT_EXIT(parseHypergraphFromString("2 3 10\n1 2\n2 3\n1\nx\n1\n"),
+              ::testing::ExitedWithCode(1),
+              "Error: Weight of hypernode 1 is invalid");
+}
+
+#ifdef KAHYPAR_USE_ZLIB
+TEST_F(AHypergraphFileWithHypernodeAndHyperedgeWeights, CanBeParsedIfGzipCompressed) {
+  HyperedgeIndexVector index_vector;
+  HyperedgeVector edge_vector;
+  HypernodeWeightVector hypernode_weights;
+  HyperedgeWeightVector hyperedge_weights;
+
+  readHypergraphFile(_filename + ".gz", _num_hypernodes, _num_hyperedges, index_vector,
+                     edge_vector, &hyperedge_weights, &hypernode_weights);
+
+  ASSERT_THAT(index_vector, ContainerEq(_control_index_vector));
+  ASSERT_THAT(edge_vector, ContainerEq(_control_edge_vector));
+  ASSERT_THAT(hyperedge_weights, ContainerEq(_control_hyperedge_weights));
+  ASSERT_THAT(hypernode_weights, ContainerEq(_control_hypernode_weights));
+}
+
+TEST(ALargeGzipCompressedHypergraphFile, IsParsedIdenticallyToTheUncompressedFile) {
+  // large enough to be decompressed and parsed in several blocks
+  const HyperedgeID num_hyperedges = 500000;
+  const HypernodeID num_hypernodes = 100000;
+  std::ostringstream contents;
+  contents << "% comment\n" << num_hyperedges << " " << num_hypernodes << " 1\n";
+  for (HyperedgeID he = 0; he < num_hyperedges; ++he) {
+    contents << (he % 7) + 1;
+    for (HypernodeID i = 0; i < (he % 5) + 2; ++i) {
+      contents << " " << ((he * 31 + i * 17) % num_hypernodes) + 1;
+    }
+    contents << "\n";
+  }
+  const std::string filename("test_instances/large_hypergraph.hgr");
+  std::ofstream(filename) << contents.str();
+  gzFile compressed_file = gzopen((filename + ".gz").c_str(), "wb");
+  gzwrite(compressed_file, contents.str().data(), contents.str().size());
+  gzclose(compressed_file);
+
+  HypernodeID num_hypernodes_uncompressed = 0;
+  HyperedgeID num_hyperedges_uncompressed = 0;
+  HyperedgeIndexVector index_vector_uncompressed;
+  HyperedgeVector edge_vector_uncompressed;
+  HyperedgeWeightVector hyperedge_weights_uncompressed;
+  readHypergraphFile(filename, num_hypernodes_uncompressed, num_hyperedges_uncompressed,
+                     index_vector_uncompressed, edge_vector_uncompressed,
+                     &hyperedge_weights_uncompressed);
+
+  HypernodeID num_hypernodes_compressed = 0;
+  HyperedgeID num_hyperedges_compressed = 0;
+  HyperedgeIndexVector index_vector_compressed;
+  HyperedgeVector edge_vector_compressed;
+  HyperedgeWeightVector hyperedge_weights_compressed;
+  readHypergraphFile(filename + ".gz", num_hypernodes_compressed, num_hyperedges_compressed,
+                     index_vector_compressed, edge_vector_compressed,
+                     &hyperedge_weights_compressed);
+
+  ASSERT_THAT(num_hypernodes_compressed, Eq(num_hypernodes));
+  ASSERT_THAT(num_hyperedges_compressed, Eq(num_hyperedges));
+  ASSERT_THAT(num_hypernodes_uncompressed, Eq(num_hypernodes));
+  ASSERT_THAT(num_hyperedges_uncompressed, Eq(num_hyperedges));
+  ASSERT_THAT(index_vector_compressed, ContainerEq(index_vector_uncompressed));
+  ASSERT_THAT(edge_vector_compressed, ContainerEq(edge_vector_uncompressed));
+  ASSERT_THAT(hyperedge_weights_compressed, ContainerEq(hyperedge_weights_uncompressed));
+  std::remove(filename.c_str());
+  std::remove((filename + ".gz").c_str());
+}
+
+TEST(AGzipCompressedPartitionFile, CanBeParsed) {
+  const std::string filename("test_instances/partition.gz");
+  const std::string contents("0\n1\n-1\n2\n");
+  gzFile compressed_file = gzopen(filename.c_str(), "wb");
+  gzwrite(compressed_file, contents.data(), contents.size());
+  gzclose(compressed_file);
+
+  std::vector<PartitionID> partition;
+  readPartitionFile(filename, partition);
+
+  ASSERT_THAT(partition, ContainerEq(std::vector<PartitionID>{ 0, 1, -1, 2 }));
+  std::remove(filename.c_str());
+}
+#endif
+
 TEST(AHypergraphWithoutHyperedges, CanBeWrittenToFile) {
   HypernodeID num_hypernodes = 0;
   HyperedgeID num_hyperedges = 0;
@@ -197,6 +360,107 @@ TEST_F(AHypergraphWithHypernodeAndHyperedgeWeights, CanBeWrittenToFile) {
   ASSERT_THAT(verifyEquivalenceWithPartitionInfo(*_hypergraph, hypergraph2), Eq(true));
 }
 
+TEST_F(AHypergraphWithHypernodeAndHyperedgeWeights, CanBeWrittenToBinaryFile) {
+  const std::string filename = _filename + ".bin";
+  const std::vector<PartitionID> communities = { 0, 0, 1, 1, 2, 2, 2 };
+  _hypergraph->setFixedVertex(0, 1);
+  _hypergraph->setFixedVertex(6, 0);
+  _hypergraph->setCommunities(std::vector<PartitionID>(communities));
+  writeBinaryHypergraphFile(*_hypergraph, filename, &communities);
+
+  ASSERT_THAT(isBinaryHypergraphFile(filename), Eq(true));
+  ASSERT_THAT(isBinaryHypergraphFile("test_instances/unweighted_hypergraph.hgr"), Eq(false));
+  Hypergraph hypergraph2(createHypergraphFromFile(filename, 2));
+
+  ASSERT_THAT(verifyEquivalenceWithPartitionInfo(*_hypergraph, hypergraph2), Eq(true));
+  ASSERT_THAT(hypergraph2.type(), Eq(HypergraphType::EdgeAndNodeWeights));
+  ASSERT_THAT(hypergraph2.numFixedVertices(), Eq(2));
+  ASSERT_THAT(hypergraph2.fixedVertexPartID(0), Eq(1));
+  ASSERT_THAT(hypergraph2.fixedVertexPartID(6), Eq(0));
+  ASSERT_THAT(hypergraph2.isFixedVertex(3), Eq(false));
+  ASSERT_THAT(hypergraph2.communities(), ContainerEq(communities));
+
+  std::vector<ClusterID> read_communities;
+  createHypergraphFromFile(filename, 2, InputFormat::automatic, MatrixModel::row_net, nullptr,
+                           &read_communities);
+  ASSERT_THAT(read_communities, ContainerEq(communities));
+  std::remove(filename.c_str());
+}
+
+TEST_F(AnUnweightedHypergraph, CanBeWrittenToBinaryFile) {
+  const std::string filename = _filename + ".bin";
+  writeBinaryHypergraphFile(*_hypergraph, filename);
+
+  Hypergraph hypergraph2(createHypergraphFromFile(filename, 2));
+
+  ASSERT_THAT(verifyEquivalenceWithPartitionInfo(*_hypergraph, hypergraph2), Eq(true));
+  ASSERT_THAT(hypergraph2.type(), Eq(HypergraphType::Unweighted));
+  ASSERT_THAT(hypergraph2.containsFixedVertices(), Eq(false));
+  std::remove(filename.c_str());
+}
+
+TEST_F(AHypergraphWithHypernodeAndHyperedgeWeights, CanBeWrittenToBinaryFileWithCompressedPins) {
+  const std::string filename = _filename + ".bin";
+  _hypergraph->setFixedVertex(2, 1);
+  writeBinaryHypergraphFile(*_hypergraph, filename, nullptr, true);
+
+  ASSERT_THAT(isBinaryHypergraphFile(filename), Eq(true));
+  Hypergraph hypergraph2(createHypergraphFromFile(filename, 2));
+
+  ASSERT_THAT(verifyEquivalenceWithPartitionInfo(*_hypergraph, hypergraph2), Eq(true));
+  ASSERT_THAT(hypergraph2.type(), Eq(HypergraphType::EdgeAndNodeWeights));
+  ASSERT_THAT(hypergraph2.fixedVertexPartID(2), Eq(1));
+  std::remove(filename.c_str());
+}
+
+using ABinaryHypergraphFileDeathTest = AHypergraphWithHypernodeAndHyperedgeWeights;
+
+TEST_F(ABinaryHypergraphFileDeathTest, WithFixedVerticesOutsideOfTheBlocksLeadsToProgramExit) {
+  const std::string filename = _filename + ".bin";
+  _hypergraph->setFixedVertex(2, 1);
+  writeBinaryHypergraphFile(*_hypergraph, filename);
+
+  EXPECT_EXIT(createHypergraphFromFile(filename, 1),
+              ::testing::ExitedWithCode(1),
+              "Error: Hypernode 2 of binary hypergraph file .* is fixed to block 1, but k = 1");
+  std::remove(filename.c_str());
+}
+
+TEST(ABinaryHypergraphFileWithCompressedPins, IsDecodedIntoSortedPinLists) {
+  // large IDs and enough hyperedges to span several independently decoded blocks
+  const HypernodeID num_hypernodes = 1 << 20;
+  const HyperedgeID num_hyperedges = 3 * binary::kEdgesPerBlock + 17;
+  HyperedgeIndexVector index_vector = { 0 };
+  HyperedgeVector edge_vector;
+  for (HyperedgeID he = 0; he < num_hyperedges; ++he) {
+    const HypernodeID size = 1 + he % 23;
+    for (HypernodeID i = 0; i < size; ++i) {
+      edge_vector.push_back((static_cast<uint64_t>(he) * 7919 + i * (1 + he % 5000)) %
+                            num_hypernodes);
+    }
+    std::sort(edge_vector.begin() + index_vector.back(), edge_vector.end());
+    edge_vector.erase(std::unique(edge_vector.begin() + index_vector.back(), edge_vector.end()),
+                      edge_vector.end());
+    index_vector.push_back(edge_vector.size());
+  }
+  const std::string filename = "test_instances/compressed_pins.bin";
+  Hypergraph hypergraph(num_hypernodes, num_hyperedges, index_vector, edge_vector);
+  writeBinaryHypergraphFile(hypergraph, filename, nullptr, true);
+
+  HypernodeID read_num_hypernodes = 0;
+  HyperedgeID read_num_hyperedges = 0;
+  HyperedgeIndexVector read_index_vector;
+  HyperedgeVector read_edge_vector;
+  readHypergraphFile(filename, read_num_hypernodes, read_num_hyperedges,
+                     read_index_vector, read_edge_vector);
+
+  ASSERT_THAT(read_num_hypernodes, Eq(num_hypernodes));
+  ASSERT_THAT(read_num_hyperedges, Eq(num_hyperedges));
+  ASSERT_THAT(read_index_vector, ContainerEq(index_vector));
+  ASSERT_THAT(read_edge_vector, ContainerEq(edge_vector));
+  std::remove(filename.c_str());
+}
+
 TEST_F(APartitionOfAHypergraph, IsCorrectlyWrittenToFile) {
   multilevel::partition(_hypergraph, *_coarsener, *_refiner, _context);
   writePartitionFile(_hypergraph, _context.partition.graph_partition_filename);
@@ -208,6 +472,102 @@ TEST_F(APartitionOfAHypergraph, IsCorrectlyWrittenToFile) {
   }
 }
 
+TEST_F(APartitionOfAHypergraph, IsCorrectlyWrittenToBinaryFile) {
+  multilevel::partition(_hypergraph, *_coarsener, *_refiner, _context);
+  const std::string filename = _context.partition.graph_partition_filename + ".bin";
+  writeBinaryPartitionFile(_hypergraph, filename);
+
+  ASSERT_THAT(isBinaryPartitionFile(filename), Eq(true));
+  ASSERT_THAT(isBinaryPartitionFile(_context.partition.graph_partition_filename), Eq(false));
+  std::vector<PartitionID> read_partition;
+  readPartitionFile(filename, read_partition);
+  ASSERT_THAT(read_partition.size(), Eq(_hypergraph.initialNumNodes()));
+  for (const HypernodeID& hn : _hypergraph.nodes()) {
+    ASSERT_THAT(read_partition[hn], Eq(_hypergraph.partID(hn)));
+  }
+  std::remove(filename.c_str());
+}
+
+static void writeBinaryPartitionHeader(const std::string& filename, const char (& magic)[8],
+                                       const uint64_t num_hypernodes) {
+  binary::PartitionHeader header = { };
+  memcpy(header.magic, magic, sizeof(header.magic));
+  header.version = binary::kPartitionVersion;
+  header.id_size = sizeof(PartitionID);
+  header.num_hypernodes = num_hypernodes;
+  const std::vector<PartitionID> partition = { 0, 1 };
+  std::ofstream out_stream(filename.c_str(), std::ios::binary);
+  out_stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  out_stream.write(reinterpret_cast<const char*>(partition.data()),
+                   partition.size() * sizeof(PartitionID));
+}
+
+TEST(ABinaryPartitionFileDeathTest, WithWrongMagicLeadsToProgramExit) {
+  const std::string filename = "test_instances/wrong_magic_partition.bin";
+  writeBinaryPartitionHeader(filename, binary::kMagic, 2);
+
+  std::vector<PartitionID> partition;
+  EXPECT_EXIT(readBinaryPartitionFile(filename, partition),
+              ::testing::ExitedWithCode(1),
+              "is not a valid binary partition file");
+  std::remove(filename.c_str());
+}
+
+TEST(ABinaryPartitionFileDeathTest, WithOverflowingNumberOfHypernodesLeadsToProgramExit) {
+  const std::string filename = "test_instances/overflowing_partition.bin";
+  // num_hypernodes * sizeof(PartitionID) wraps around to a size smaller than the file
+  writeBinaryPartitionHeader(filename, binary::kPartitionMagic,
+                             (std::numeric_limits<uint64_t>::max() / sizeof(PartitionID)) + 2);
+
+  std::vector<PartitionID> partition;
+  EXPECT_EXIT(readBinaryPartitionFile(filename, partition),
+              ::testing::ExitedWithCode(1),
+              "is not a valid binary partition file");
+  std::remove(filename.c_str());
+}
+
+TEST(ALargePartition, IsWrittenInParallelChunksInNodeOrder) {
+  const HypernodeID num_hypernodes = 4 * internal::kMinNodesPerChunk + 3;
+  const PartitionID k = 1000;
+  Hypergraph hypergraph(num_hypernodes, 1, HyperedgeIndexVector { 0, 2 },
+                        HyperedgeVector { 0, 1 }, k);
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    hypergraph.setNodePart(hn, (static_cast<uint64_t>(hn) * 7919) % k);
+  }
+  const std::string filename = "test_instances/large_partition.part";
+  writePartitionFile(hypergraph, filename);
+
+  std::ifstream file(filename);
+  std::string line;
+  HypernodeID hn = 0;
+  while (std::getline(file, line)) {
+    ASSERT_THAT(line, Eq(std::to_string(hypergraph.partID(hn))));
+    ++hn;
+  }
+  ASSERT_THAT(hn, Eq(num_hypernodes));
+  std::remove(filename.c_str());
+}
+
+TEST(APartitionOfACoarseHypergraph, OnlyContainsTheEnabledHypernodes) {
+  const HypernodeID num_hypernodes = 2 * internal::kMinNodesPerChunk + 5;
+  Hypergraph hypergraph(num_hypernodes, 1, HyperedgeIndexVector { 0, 2 },
+                        HyperedgeVector { 0, num_hypernodes - 1 }, 2);
+  hypergraph.contract(0, num_hypernodes - 1);
+  hypergraph.contract(0, internal::kMinNodesPerChunk);
+  std::vector<PartitionID> expected_partition;
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    hypergraph.setNodePart(hn, hn % 2);
+    expected_partition.push_back(hn % 2);
+  }
+  const std::string filename = "test_instances/coarse_partition.part";
+  writePartitionFile(hypergraph, filename);
+
+  std::vector<PartitionID> partition;
+  readPartitionFile(filename, partition);
+  ASSERT_THAT(partition, ContainerEq(expected_partition));
+  std::remove(filename.c_str());
+}
+
 TEST(AHypergraph, CanBeSerializedToPaToHFormat) {
   HyperedgeWeightVector he_weights = { 10, 15, 13, 18, 25, 20, 14, 27, 29 };
   HypernodeWeightVector hn_weights = HypernodeWeightVector { 80, 85, 30, 55, 42, 39, 90, 102 };
@@ -243,10 +603,206 @@ TEST(AHypergraph, CanBeSerializedToPaToHFormat) {
   ASSERT_THAT(serialized_lines, ::testing::ContainerEq(original_lines));
 }
 
+TEST(AMatrixMarketFile, IsReadUsingTheRowNetModel) {
+  HypernodeID num_hypernodes = 0;
+  HyperedgeID num_hyperedges = 0;
+  HyperedgeIndexVector index_vector;
+  HyperedgeVector edge_vector;
+  readMatrixMarketFile("test_instances/sparse_matrix.mtx", MatrixModel::row_net, num_hypernodes,
+                       num_hyperedges, index_vector, edge_vector, nullptr);
+
+  // the empty third row is removed
+  ASSERT_THAT(num_hypernodes, Eq(5));
+  ASSERT_THAT(num_hyperedges, Eq(3));
+  ASSERT_THAT(index_vector, ContainerEq(HyperedgeIndexVector { 0, 2, 4, 7 }));
+  ASSERT_THAT(edge_vector, ContainerEq(HyperedgeVector { 0, 2, 1, 4, 0, 3, 4 }));
+}
+
+TEST(AMatrixMarketFile, IsReadUsingTheColumnNetModel) {
+  HypernodeID num_hypernodes = 0;
+  HyperedgeID num_hyperedges = 0;
+  HyperedgeIndexVector index_vector;
+  HyperedgeVector edge_vector;
+  readMatrixMarketFile("test_instances/sparse_matrix.mtx", MatrixModel::column_net,
+                       num_hypernodes, num_hyperedges, index_vector, edge_vector, nullptr);
+
+  ASSERT_THAT(num_hypernodes, Eq(4));
+  ASSERT_THAT(num_hyperedges, Eq(5));
+  ASSERT_THAT(index_vector, ContainerEq(HyperedgeIndexVector { 0, 2, 3, 4, 5, 7 }));
+  ASSERT_THAT(edge_vector, ContainerEq(HyperedgeVector { 0, 3, 1, 0, 3, 3, 1 }));
+}
+
+TEST(AMatrixMarketFile, IsReadUsingTheFineGrainModel) {
+  HypernodeID num_hypernodes = 0;
+  HyperedgeID num_hyperedges = 0;
+  HyperedgeIndexVector index_vector;
+  HyperedgeVector edge_vector;
+  readMatrixMarketFile("test_instances/sparse_matrix.mtx", MatrixModel::fine_grain,
+                       num_hypernodes, num_hyperedges, index_vector, edge_vector, nullptr);
+
+  // one hypernode per nonzero, row hyperedges followed by column hyperedges
+  ASSERT_THAT(num_hypernodes, Eq(7));
+  ASSERT_THAT(num_hyperedges, Eq(8));
+  ASSERT_THAT(index_vector, ContainerEq(HyperedgeIndexVector { 0, 2, 4, 7, 9, 10, 11, 12, 14 }));
+  ASSERT_THAT(edge_vector, ContainerEq(HyperedgeVector { 0, 1, 2, 6, 3, 4, 5, 0, 3, 2, 1, 4, 5,
+                                                         6 }));
+}
+
+TEST(AMatrixMarketFile, IsExpandedIfTheMatrixIsSymmetric) {
+  const Hypergraph hypergraph = createHypergraphFromFile("test_instances/symmetric_matrix.mtx", 2);
+
+  ASSERT_THAT(hypergraph.initialNumNodes(), Eq(3));
+  ASSERT_THAT(hypergraph.initialNumEdges(), Eq(3));
+  ASSERT_THAT(std::vector<HypernodeID>(hypergraph.pins(0).first, hypergraph.pins(0).second),
+              ContainerEq(std::vector<HypernodeID>({ 0, 1 })));
+  ASSERT_THAT(std::vector<HypernodeID>(hypergraph.pins(1).first, hypergraph.pins(1).second),
+              ContainerEq(std::vector<HypernodeID>({ 0, 2 })));
+  ASSERT_THAT(std::vector<HypernodeID>(hypergraph.pins(2).first, hypergraph.pins(2).second),
+              ContainerEq(std::vector<HypernodeID>({ 1, 2 })));
+}
+
+TEST_F(AHypergraphWithHypernodeAndHyperedgeWeights, CanBeReadFromPaToHFile) {
+  const std::string filename = _filename + ".patoh";
+  writeHypergraphForPaToHPartitioning(*_hypergraph, filename);
+
+  ASSERT_THAT(detectInputFormat(filename), Eq(InputFormat::patoh));
+  Hypergraph hypergraph2(createHypergraphFromFile(filename, 2));
+
+  ASSERT_THAT(verifyEquivalenceWithoutPartitionInfo(*_hypergraph, hypergraph2), Eq(true));
+  std::remove(filename.c_str());
+}
+
 TEST(AHypergraphDeathTest, WithEmptyHyperedgesLeadsToProgramExit) {
   EXPECT_EXIT(createHypergraphFromFile("test_instances/corrupted_hypergraph_with_empty_hyperedges.hgr", 2),
               ::testing::ExitedWithCode(1),
               "Error: Hyperedge 1 is empty");
 }
+
+TEST(AHypergraphDeathTest, WithDuplicatePinsLeadsToProgramExit) {
+  EXPECT_EXIT(createHypergraphFromFile("test_instances/hypergraph_with_duplicate_pins.hgr", 2),
+              ::testing::ExitedWithCode(1),
+              "Hyperedge 1 contains hypernode 2 more than once");
+}
+
+TEST(HypergraphValidation, DetectsPinsThatAreOutOfRange) {
+  const HyperedgeIndexVector index_vector = { 0, 2, 4 };
+  const HyperedgeVector edge_vector = { 0, 1, 2, 4 };
+  const HypergraphStats stats = validateHypergraph(4, 2, index_vector, edge_vector);
+
+  ASSERT_THAT(stats.valid(), Eq(false));
+  ASSERT_THAT(stats.error,
+              Eq("Hyperedge 2 contains hypernode 5, but the hypergraph only has 4 hypernodes"));
+}
+
+TEST(HypergraphValidation, DetectsDuplicatePinsInLargeHyperedges) {
+  HyperedgeIndexVector index_vector = { 0, 20 };
+  HyperedgeVector edge_vector;
+  for (HypernodeID hn = 0; hn < 20; ++hn) {
+    edge_vector.push_back(hn == 17 ? 3 : hn);
+  }
+  const HypergraphStats stats = validateHypergraph(20, 1, index_vector, edge_vector);
+
+  ASSERT_THAT(stats.error, Eq("Hyperedge 1 contains hypernode 4 more than once"));
+}
+
+TEST(HypergraphValidation, DetectsEmptyHyperedgesAndNegativeWeights) {
+  const HyperedgeIndexVector index_vector = { 0, 2, 2, 3 };
+  const HyperedgeVector edge_vector = { 0, 1, 2 };
+  ASSERT_THAT(validateHypergraph(3, 3, index_vector, edge_vector).error,
+              Eq("Hyperedge 2 is empty"));
+
+  const HyperedgeIndexVector valid_index_vector = { 0, 2, 3 };
+  const HyperedgeWeightVector hyperedge_weights = { 1, -2 };
+  const HypernodeWeightVector hypernode_weights = { 1, 1, -1 };
+  ASSERT_THAT(validateHypergraph(3, 2, valid_index_vector, edge_vector, &hyperedge_weights).error,
+              Eq("Hyperedge 2 has negative weight -2"));
+  ASSERT_THAT(validateHypergraph(3, 2, valid_index_vector, edge_vector, nullptr,
+                                 &hypernode_weights).error,
+              Eq("Hypernode 3 has negative weight -1"));
+}
+
+TEST(HypergraphValidation, DetectsWeightOverflow) {
+  const HyperedgeIndexVector index_vector = { 0, 2, 3 };
+  const HyperedgeVector edge_vector = { 0, 1, 2 };
+  const HypernodeWeightVector hypernode_weights = {
+    std::numeric_limits<HypernodeWeight>::max() / 2, std::numeric_limits<HypernodeWeight>::max() / 2, 2
+  };
+  const HypergraphStats stats = validateHypergraph(3, 2, index_vector, edge_vector, nullptr,
+                                                   &hypernode_weights);
+
+  ASSERT_THAT(stats.valid(), Eq(false));
+  ASSERT_THAT(stats.error.find("Total hypernode weight exceeds"), Eq(0));
+}
+
+TEST_F(AHypergraphWithHypernodeAndHyperedgeWeights, HasTheSameStatisticsAfterValidation) {
+  HypernodeID num_hypernodes = 0;
+  HyperedgeID num_hyperedges = 0;
+  HyperedgeIndexVector index_vector;
+  HyperedgeVector edge_vector;
+  HyperedgeWeightVector hyperedge_weights;
+  HypernodeWeightVector hypernode_weights;
+  readHypergraphFile("test_instances/weighted_hyperedges_and_hypernodes_hypergraph.hgr",
+                     num_hypernodes, num_hyperedges, index_vector, edge_vector,
+                     &hyperedge_weights, &hypernode_weights);
+  const HypergraphStats stats = validateHypergraph(num_hypernodes, num_hyperedges, index_vector,
+                                                   edge_vector, &hyperedge_weights,
+                                                   &hypernode_weights);
+  const HypergraphStats control_stats = computeHypergraphStats(*_hypergraph);
+
+  ASSERT_THAT(stats.valid(), Eq(true));
+  ASSERT_THAT(stats.num_pins, Eq(control_stats.num_pins));
+  ASSERT_THAT(stats.num_single_pin_hyperedges, Eq(control_stats.num_single_pin_hyperedges));
+  ASSERT_THAT(stats.he_size.med, Eq(control_stats.he_size.med));
+  ASSERT_THAT(stats.he_weight.sum, Eq(control_stats.he_weight.sum));
+  ASSERT_THAT(stats.hn_degree.max, Eq(control_stats.hn_degree.max));
+  ASSERT_THAT(stats.hn_weight.sum, Eq(_hypergraph->totalWeight()));
+}
+
+TEST_F(AHypergraphWithHypernodeAndHyperedgeWeights, HasTheSameStatisticsWhenReadAsynchronously) {
+  std::shared_future<HypergraphStats> stats;
+  const Hypergraph hypergraph = createHypergraphFromFile(
+    "test_instances/weighted_hyperedges_and_hypernodes_hypergraph.hgr", 2,
+    InputFormat::automatic, MatrixModel::row_net, &stats);
+  const HypergraphStats control_stats = computeHypergraphStats(*_hypergraph);
+
+  ASSERT_THAT(stats.valid(), Eq(true));
+  ASSERT_THAT(stats.get().valid(), Eq(true));
+  ASSERT_THAT(stats.get().num_pins, Eq(control_stats.num_pins));
+  ASSERT_THAT(stats.get().he_size.med, Eq(control_stats.he_size.med));
+  ASSERT_THAT(stats.get().he_weight.sum, Eq(control_stats.he_weight.sum));
+  ASSERT_THAT(stats.get().hn_degree.sd, Eq(control_stats.hn_degree.sd));
+  ASSERT_THAT(stats.get().hn_weight.sum, Eq(hypergraph.totalWeight()));
+}
+
+TEST(HypergraphValidation, ReportsErrorsImmediatelyWhenRunAsynchronously) {
+  const HyperedgeIndexVector index_vector = { 0, 2, 2 };
+  const HyperedgeVector edge_vector = { 0, 1 };
+  const std::shared_future<HypergraphStats> stats = validateHypergraphAsync(3, 2, index_vector,
+                                                                            edge_vector);
+
+  ASSERT_THAT(stats.wait_for(std::chrono::seconds(0)), Eq(std::future_status::ready));
+  ASSERT_THAT(stats.get().error, Eq("Hyperedge 2 is empty"));
+}
+
+TEST(AHypergraphStatistic, HasTheSameQuantilesAsTheSortedValues) {
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<HypernodeID> distribution(1, 100);
+  for (size_t size = 1; size < 40; ++size) {
+    std::vector<HypernodeID> values(size);
+    for (HypernodeID& value : values) {
+      value = distribution(generator);
+    }
+    std::vector<HypernodeID> sorted_values = values;
+    std::sort(sorted_values.begin(), sorted_values.end());
+    const Distribution stats = internal::createDistribution(values);
+    const auto quartiles = math::firstAndThirdQuartile(sorted_values);
+
+    ASSERT_THAT(stats.min, Eq(sorted_values.front()));
+    ASSERT_THAT(stats.max, Eq(sorted_values.back()));
+    ASSERT_THAT(stats.med, Eq(math::median(sorted_values)));
+    ASSERT_THAT(stats.q1, Eq(quartiles.first));
+    ASSERT_THAT(stats.q3, Eq(quartiles.second));
+  }
+}
 }  // namespace io
 }  // namespace kahypar
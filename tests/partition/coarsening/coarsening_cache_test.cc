@@ -0,0 +1,164 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2018 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "kahypar/definitions.h"
+#include "kahypar/partition/coarsening/coarsening_cache.h"
+#include "kahypar/partition/coarsening/lazy_vertex_pair_coarsener.h"
+#include "kahypar/partition/coarsening/policies/fixed_vertex_acceptance_policy.h"
+#include "kahypar/partition/coarsening/policies/rating_tie_breaking_policy.h"
+#include "tests/partition/coarsening/vertex_pair_coarsener_test_fixtures.h"
+
+using ::testing::ContainerEq;
+
+namespace kahypar {
+using CoarsenerType = LazyVertexPairCoarsener<HeavyEdgeScore,
+                                              MultiplicativePenalty,
+                                              UseCommunityStructure,
+                                              NormalPartitionPolicy,
+                                              BestRatingWithTieBreaking<FirstRatingWins>,
+                                              AllowFreeOnFixedFreeOnFreeFixedOnFixed,
+                                              RatingType>;
+
+class ACoarseningCache : public ACoarsenerBase<CoarsenerType>{
+ public:
+  ACoarseningCache() :
+    ACoarsenerBase(),
+    replay_hypergraph(createHypergraph()),
+    replay_coarsener(*replay_hypergraph, context,  /* heaviest_node_weight */ 1),
+    filename("coarsening_cache_test.cache") {
+    context.partition.coarsening_cache_filename = filename;
+  }
+
+  ~ACoarseningCache() override {
+    std::remove(filename.c_str());
+  }
+
+  static Hypergraph* createHypergraph() {
+    return new Hypergraph(7, 4, HyperedgeIndexVector { 0, 2, 6, 9,  /*sentinel*/ 12 },
+                          HyperedgeVector { 0, 2, 0, 1, 3, 4, 3, 4, 6, 2, 5, 6 });
+  }
+
+  static std::vector<HypernodeID> enabledPins(const Hypergraph& hypergraph) {
+    std::vector<HypernodeID> pins;
+    for (const HyperedgeID& he : hypergraph.edges()) {
+      pins.push_back(he);
+      for (const HypernodeID& pin : hypergraph.pins(he)) {
+        pins.push_back(pin);
+      }
+    }
+    return pins;
+  }
+
+  std::unique_ptr<Hypergraph> replay_hypergraph;
+  CoarsenerType replay_coarsener;
+  std::string filename;
+};
+
+TEST_F(ACoarseningCache, ReplaysContractionsIntoTheSameCoarseHypergraph) {
+  coarsener.coarsen(2);
+  const ContractionSequence contractions = coarsener.contractions();
+
+  ASSERT_THAT(replay_coarsener.coarsen(contractions, 2), Eq(contractions.size()));
+  ASSERT_THAT(replay_coarsener.contractions(), ContainerEq(contractions));
+  ASSERT_THAT(replay_hypergraph->currentNumNodes(), Eq(hypergraph->currentNumNodes()));
+  ASSERT_THAT(replay_hypergraph->currentNumEdges(), Eq(hypergraph->currentNumEdges()));
+  ASSERT_THAT(enabledPins(*replay_hypergraph), ContainerEq(enabledPins(*hypergraph)));
+}
+
+TEST_F(ACoarseningCache, CanBeUncoarsenedAfterReplayingContractions) {
+  coarsener.coarsen(2);
+  replay_coarsener.coarsen(coarsener.contractions(), 2);
+  for (const HypernodeID& hn : replay_hypergraph->nodes()) {
+    replay_hypergraph->setNodePart(hn, hn % 2);
+  }
+  replay_hypergraph->initializeNumCutHyperedges();
+  replay_coarsener.uncoarsen(*refiner);
+
+  ASSERT_THAT(replay_hypergraph->currentNumNodes(), Eq(7));
+  ASSERT_THAT(replay_hypergraph->currentNumEdges(), Eq(4));
+  ASSERT_THAT(replay_hypergraph->currentNumPins(), Eq(12));
+}
+
+TEST_F(ACoarseningCache, StopsReplayingAtTheContractionLimit) {
+  coarsener.coarsen(2);
+  const ContractionSequence contractions = coarsener.contractions();
+
+  ASSERT_THAT(replay_coarsener.coarsen(contractions, 6), Eq(1));
+  ASSERT_THAT(replay_hypergraph->currentNumNodes(), Eq(6));
+}
+
+TEST_F(ACoarseningCache, ContinuesCoarseningIfAContractionExceedsTheMaximumNodeWeight) {
+  coarsener.coarsen(2);
+  const ContractionSequence contractions = coarsener.contractions();
+  context.coarsening.max_allowed_node_weight = 2;
+
+  ASSERT_THAT(replay_coarsener.coarsen(contractions, 2), Le(contractions.size()));
+  for (const HypernodeID& hn : replay_hypergraph->nodes()) {
+    ASSERT_THAT(replay_hypergraph->nodeWeight(hn), Le(2));
+  }
+}
+
+TEST_F(ACoarseningCache, IsOnlyReadForTheSameFingerprints) {
+  const ContractionSequence contractions = { { 0, 2 }, { 3, 4 } };
+  coarsening_cache::write(filename, 42, 23, contractions);
+
+  ContractionSequence cached_contractions;
+  ASSERT_THAT(coarsening_cache::read(filename, 42, 24, cached_contractions), Eq(false));
+  ASSERT_THAT(coarsening_cache::read(filename, 41, 23, cached_contractions), Eq(false));
+  ASSERT_THAT(coarsening_cache::read(filename, 42, 23, cached_contractions), Eq(true));
+  ASSERT_THAT(cached_contractions, ContainerEq(contractions));
+}
+
+TEST_F(ACoarseningCache, HasDifferentFingerprintsForDifferentHypergraphs) {
+  ASSERT_THAT(coarsening_cache::fingerprint(*replay_hypergraph),
+              Eq(coarsening_cache::fingerprint(*hypergraph)));
+  replay_hypergraph->setNodeWeight(3, 2);
+  ASSERT_THAT(coarsening_cache::fingerprint(*replay_hypergraph),
+              ::testing::Ne(coarsening_cache::fingerprint(*hypergraph)));
+}
+
+TEST_F(ACoarseningCache, HasDifferentFingerprintsForDifferentMinimumShrinkFactors) {
+  const uint64_t fingerprint = coarsening_cache::fingerprint(context);
+  context.coarsening.min_shrink_factor = 1.5;
+  ASSERT_THAT(coarsening_cache::fingerprint(context), ::testing::Ne(fingerprint));
+}
+
+TEST_F(ACoarseningCache, IsCreatedByTheFirstRunAndReplayedByTheSecondRun) {
+  coarsening_cache::coarsen(*hypergraph, coarsener, context);
+  const ContractionSequence contractions = coarsener.contractions();
+
+  ContractionSequence cached_contractions;
+  ASSERT_THAT(coarsening_cache::read(filename, coarsening_cache::fingerprint(*replay_hypergraph),
+                                     coarsening_cache::fingerprint(context), cached_contractions),
+              Eq(true));
+  ASSERT_THAT(cached_contractions, ContainerEq(contractions));
+
+  coarsening_cache::coarsen(*replay_hypergraph, replay_coarsener, context);
+  ASSERT_THAT(replay_coarsener.contractions(), ContainerEq(contractions));
+  ASSERT_THAT(enabledPins(*replay_hypergraph), ContainerEq(enabledPins(*hypergraph)));
+}
+}  // namespace kahypar
@@ -0,0 +1,107 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2018 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <memory>
+
+#include "gmock/gmock.h"
+
+#include "kahypar/definitions.h"
+#include "kahypar/partition/coarsening/ml_coarsener.h"
+#include "kahypar/partition/coarsening/policies/fixed_vertex_acceptance_policy.h"
+#include "kahypar/partition/coarsening/policies/rating_tie_breaking_policy.h"
+#include "tests/partition/coarsening/vertex_pair_coarsener_test_fixtures.h"
+
+namespace kahypar {
+using CoarsenerType = MLCoarsener<HeavyEdgeScore,
+                                  MultiplicativePenalty,
+                                  UseCommunityStructure,
+                                  NormalPartitionPolicy,
+                                  BestRatingWithTieBreaking<FirstRatingWins>,
+                                  AllowFreeOnFixedFreeOnFreeFixedOnFixed,
+                                  RatingType>;
+
+class AnMLCoarsener : public ACoarsenerBase<CoarsenerType>{
+ public:
+  AnMLCoarsener() :
+    ACoarsenerBase() { }
+};
+
+// Hub 0 with leaves 1 to 9 and the isolated hypernodes 10 and 11
+class AnMLCoarsenerOnAStar : public ACoarsenerBase<CoarsenerType>{
+ public:
+  AnMLCoarsenerOnAStar() :
+    ACoarsenerBase(new Hypergraph(12, 9,
+                                  HyperedgeIndexVector { 0, 2, 4, 6, 8, 10, 12, 14, 16,  /*sentinel*/ 18 },
+                                  HyperedgeVector { 0, 1, 0, 2, 0, 3, 0, 4, 0, 5, 0, 6, 0, 7, 0, 8, 0, 9 })) {
+    context.coarsening.max_allowed_node_weight = 2;
+    context.partition.perfect_balance_part_weights = { 6, 6 };
+    context.partition.max_part_weights = { 7, 7 };
+  }
+};
+
+TEST_F(AnMLCoarsener, RemovesHyperedgesOfSizeOneDuringCoarsening) {
+  removesHyperedgesOfSizeOneDuringCoarsening(coarsener, hypergraph);
+}
+
+TEST_F(AnMLCoarsener, ReAddsHyperedgesOfSizeOneDuringUncoarsening) {
+  reAddsHyperedgesOfSizeOneDuringUncoarsening(coarsener, hypergraph, refiner);
+}
+
+TEST_F(AnMLCoarsenerOnAStar, StallsOnceTheHubReachesTheMaximumNodeWeight) {
+  coarsener.coarsen(2);
+
+  ASSERT_THAT(hypergraph->currentNumNodes(), Eq(11));
+}
+
+TEST_F(AnMLCoarsenerOnAStar, ClustersLeavesAndIsolatedHypernodesByTwoHopMatching) {
+  context.coarsening.min_shrink_factor = 2.0;
+  coarsener.coarsen(2);
+
+  // hub + 4 pairs of leaves + 1 pair of isolated hypernodes
+  ASSERT_THAT(hypergraph->currentNumNodes(), Eq(6));
+  HypernodeID num_isolated_hns = 0;
+  for (const HypernodeID& hn : hypergraph->nodes()) {
+    ASSERT_THAT(hypergraph->nodeWeight(hn), Eq(2));
+    num_isolated_hns += hypergraph->nodeDegree(hn) == 0;
+  }
+  ASSERT_THAT(num_isolated_hns, Eq(1));
+}
+
+TEST_F(AnMLCoarsenerOnAStar, StopsTwoHopMatchingAtTheContractionLimit) {
+  context.coarsening.min_shrink_factor = 2.0;
+  coarsener.coarsen(8);
+
+  ASSERT_THAT(hypergraph->currentNumNodes(), Eq(8));
+}
+
+TEST_F(AnMLCoarsenerOnAStar, RestoresTheInputHypergraphAfterTwoHopMatching) {
+  context.coarsening.min_shrink_factor = 2.0;
+  coarsener.coarsen(2);
+  for (const HypernodeID& hn : hypergraph->nodes()) {
+    hypergraph->setNodePart(hn, hn % 2);
+  }
+  hypergraph->initializeNumCutHyperedges();
+  coarsener.uncoarsen(*refiner);
+
+  ASSERT_THAT(hypergraph->currentNumNodes(), Eq(12));
+  ASSERT_THAT(hypergraph->currentNumEdges(), Eq(9));
+  ASSERT_THAT(hypergraph->currentNumPins(), Eq(18));
+}
+}  // namespace kahypar
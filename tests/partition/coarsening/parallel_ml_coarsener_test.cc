@@ -0,0 +1,202 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2018 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "kahypar/definitions.h"
+#include "kahypar/partition/coarsening/parallel_ml_coarsener.h"
+#include "kahypar/partition/coarsening/policies/fixed_vertex_acceptance_policy.h"
+#include "kahypar/partition/coarsening/policies/rating_tie_breaking_policy.h"
+#include "tests/partition/coarsening/vertex_pair_coarsener_test_fixtures.h"
+
+using ::testing::ContainerEq;
+using ::testing::Gt;
+
+namespace kahypar {
+using CoarsenerType = ParallelMLCoarsener<HeavyEdgeScore,
+                                          MultiplicativePenalty,
+                                          UseCommunityStructure,
+                                          NormalPartitionPolicy,
+                                          BestRatingWithTieBreaking<FirstRatingWins>,
+                                          AllowFreeOnFixedFreeOnFreeFixedOnFixed,
+                                          RatingType>;
+
+using RandomTieBreakingCoarsenerType = ParallelMLCoarsener<HeavyEdgeScore,
+                                                           MultiplicativePenalty,
+                                                           UseCommunityStructure,
+                                                           NormalPartitionPolicy,
+                                                           BestRatingPreferringUnmatched<>,
+                                                           AllowFreeOnFixedFreeOnFreeFixedOnFixed,
+                                                           RatingType>;
+
+class AParallelMLCoarsener : public ACoarsenerBase<CoarsenerType>{
+ public:
+  AParallelMLCoarsener() :
+    ACoarsenerBase() { }
+};
+
+// Large enough to be rated by several threads
+static Hypergraph* createRandomHypergraph() {
+  const HypernodeID num_hypernodes = 20000;
+  const HyperedgeID num_hyperedges = 30000;
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<HypernodeID> node(0, num_hypernodes - 1);
+  std::uniform_int_distribution<HypernodeID> size(2, 6);
+  HyperedgeIndexVector index_vector = { 0 };
+  HyperedgeVector edge_vector;
+  for (HyperedgeID he = 0; he < num_hyperedges; ++he) {
+    const HypernodeID edge_size = size(generator);
+    while (edge_vector.size() < index_vector.back() + edge_size) {
+      const HypernodeID pin = node(generator);
+      if (std::find(edge_vector.begin() + index_vector.back(), edge_vector.end(), pin) ==
+          edge_vector.end()) {
+        edge_vector.push_back(pin);
+      }
+    }
+    index_vector.push_back(edge_vector.size());
+  }
+  return new Hypergraph(num_hypernodes, num_hyperedges, index_vector, edge_vector);
+}
+
+static void setupContext(Context& context) {
+  context.partition.k = 2;
+  context.partition.epsilon = 0.03;
+  context.partition.objective = Objective::km1;
+  context.partition.mode = Mode::direct_kway;
+  context.coarsening.max_allowed_node_weight = 50;
+  context.partition.perfect_balance_part_weights = { 10000, 10000 };
+  context.partition.max_part_weights = { 10300, 10300 };
+}
+
+TEST_F(AParallelMLCoarsener, RemovesHyperedgesOfSizeOneDuringCoarsening) {
+  removesHyperedgesOfSizeOneDuringCoarsening(coarsener, hypergraph);
+}
+
+TEST_F(AParallelMLCoarsener, ReAddsHyperedgesOfSizeOneDuringUncoarsening) {
+  coarsener.coarsen(2);
+  for (const HypernodeID& hn : hypergraph->nodes()) {
+    hypergraph->setNodePart(hn, hn % 2);
+  }
+  hypergraph->initializeNumCutHyperedges();
+  coarsener.uncoarsen(*refiner);
+
+  ASSERT_THAT(hypergraph->currentNumNodes(), Eq(7));
+  ASSERT_THAT(hypergraph->currentNumEdges(), Eq(4));
+  ASSERT_THAT(hypergraph->currentNumPins(), Eq(12));
+}
+
+TEST(AParallelMLCoarsenerOnALargeHypergraph, ReachesTheContractionLimit) {
+  std::unique_ptr<Hypergraph> hypergraph(createRandomHypergraph());
+  Context context;
+  setupContext(context);
+  RandomTieBreakingCoarsenerType coarsener(*hypergraph, context, 1);
+
+  coarsener.coarsen(1000);
+
+  ASSERT_THAT(hypergraph->currentNumNodes(), Eq(1000));
+  for (const HypernodeID& hn : hypergraph->nodes()) {
+    ASSERT_THAT(hypergraph->nodeWeight(hn), Le(context.coarsening.max_allowed_node_weight));
+  }
+}
+
+TEST(AParallelMLCoarsenerOnALargeHypergraph, FindsTheSameContractionsForTheSameSeed) {
+  std::unique_ptr<Hypergraph> hypergraph(createRandomHypergraph());
+  std::unique_ptr<Hypergraph> other_hypergraph(createRandomHypergraph());
+  Context context;
+  setupContext(context);
+  RandomTieBreakingCoarsenerType coarsener(*hypergraph, context, 1);
+  RandomTieBreakingCoarsenerType other_coarsener(*other_hypergraph, context, 1);
+
+  Randomize::instance().setSeed(context.partition.seed);
+  coarsener.coarsen(1000);
+  Randomize::instance().setSeed(context.partition.seed);
+  other_coarsener.coarsen(1000);
+
+  ASSERT_THAT(coarsener.contractions().size(), Gt(0));
+  ASSERT_THAT(other_coarsener.contractions(), ContainerEq(coarsener.contractions()));
+}
+
+TEST(AParallelMLCoarsenerOnALargeHypergraph, RestoresTheInputHypergraphAfterContractingClusters) {
+  std::unique_ptr<Hypergraph> hypergraph(createRandomHypergraph());
+  std::unique_ptr<Hypergraph> input_hypergraph(createRandomHypergraph());
+  Context context;
+  setupContext(context);
+  RandomTieBreakingCoarsenerType coarsener(*hypergraph, context, 1);
+  std::unique_ptr<IRefiner> refiner(new DoNothingRefiner());
+  refiner->initialize(999999);
+
+  coarsener.coarsen(1000);
+  HypernodeWeight max_node_weight = 0;
+  for (const HypernodeID& hn : hypergraph->nodes()) {
+    max_node_weight = std::max(max_node_weight, hypergraph->nodeWeight(hn));
+    hypergraph->setNodePart(hn, hn % 2);
+  }
+  hypergraph->initializeNumCutHyperedges();
+  coarsener.uncoarsen(*refiner);
+
+  ASSERT_THAT(max_node_weight, Gt(2));
+  ASSERT_THAT(hypergraph->currentNumNodes(), Eq(input_hypergraph->currentNumNodes()));
+  ASSERT_THAT(hypergraph->currentNumEdges(), Eq(input_hypergraph->currentNumEdges()));
+  ASSERT_THAT(hypergraph->currentNumPins(), Eq(input_hypergraph->currentNumPins()));
+  for (const HyperedgeID& he : input_hypergraph->edges()) {
+    ASSERT_THAT(hypergraph->edgeWeight(he), Eq(input_hypergraph->edgeWeight(he)));
+    std::vector<HypernodeID> pins(hypergraph->pins(he).first, hypergraph->pins(he).second);
+    std::vector<HypernodeID> input_pins(input_hypergraph->pins(he).first,
+                                        input_hypergraph->pins(he).second);
+    std::sort(pins.begin(), pins.end());
+    std::sort(input_pins.begin(), input_pins.end());
+    ASSERT_THAT(pins, ContainerEq(input_pins));
+  }
+}
+
+TEST(AParallelMLCoarsenerOnALargeHypergraph, SharesTheCachedScoresOfItsRaters) {
+  using CachingCoarsenerType = ParallelMLCoarsener<EdgeFrequencyScore,
+                                                   MultiplicativePenalty,
+                                                   UseCommunityStructure,
+                                                   NormalPartitionPolicy,
+                                                   BestRatingPreferringUnmatched<>,
+                                                   AllowFreeOnFixedFreeOnFreeFixedOnFixed,
+                                                   RatingType>;
+  std::unique_ptr<Hypergraph> hypergraph(createRandomHypergraph());
+  std::unique_ptr<Hypergraph> other_hypergraph(createRandomHypergraph());
+  Context context;
+  setupContext(context);
+  context.evolutionary.gamma = 0.5;
+  context.evolutionary.edge_frequency.resize(hypergraph->initialNumEdges());
+  for (const HyperedgeID& he : hypergraph->edges()) {
+    context.evolutionary.edge_frequency[he] = he % 3;
+  }
+  CachingCoarsenerType coarsener(*hypergraph, context, 1);
+  CachingCoarsenerType other_coarsener(*other_hypergraph, context, 1);
+
+  Randomize::instance().setSeed(context.partition.seed);
+  coarsener.coarsen(1000);
+  Randomize::instance().setSeed(context.partition.seed);
+  other_coarsener.coarsen(1000);
+
+  ASSERT_THAT(hypergraph->currentNumNodes(), Eq(1000));
+  ASSERT_THAT(other_coarsener.contractions(), ContainerEq(coarsener.contractions()));
+}
+}  // namespace kahypar
@@ -58,6 +58,13 @@ using RandomWinsRater = VertexPairRater<HeavyEdgeScore,
                                         BestRatingWithTieBreaking<RandomRatingWins>,
                                         AllowFreeOnFixedFreeOnFreeFixedOnFixed,
                                         RatingType>;
+using EdgeFrequencyRater = VertexPairRater<EdgeFrequencyScore,
+                                           MultiplicativePenalty,
+                                           UseCommunityStructure,
+                                           NormalPartitionPolicy,
+                                           BestRatingWithTieBreaking<FirstRatingWins>,
+                                           AllowFreeOnFixedFreeOnFreeFixedOnFixed,
+                                           RatingType>;
 
 class ARater : public Test {
  public:
@@ -181,4 +188,42 @@ TEST_F(ARater, HandlesZeroWeightHypernodes) {
   ASSERT_THAT(rating.value, Eq(1 / 5.0));
   ASSERT_THAT(rating.valid, Eq(true));
 }
+
+TEST_F(ARater, RatesHypernodesWithSmallAndLargeNeighborhoods) {
+  // hypernode 0 has more neighbors than fit into the dense accumulator
+  HyperedgeIndexVector index_vector { 0 };
+  HyperedgeVector edge_vector;
+  for (HypernodeID hn = 1; hn <= 40; ++hn) {
+    edge_vector.insert(edge_vector.end(), { 0, hn });
+    index_vector.push_back(edge_vector.size());
+  }
+  edge_vector.insert(edge_vector.end(), { 0, 7, 8 });
+  index_vector.push_back(edge_vector.size());
+  hypergraph.reset(new Hypergraph(41, 41, index_vector, edge_vector));
+
+  FirstWinsRater rater(*hypergraph, context);
+
+  ASSERT_THAT(rater.rate(0).target, Eq(8));
+  ASSERT_THAT(rater.rate(0).value, DoubleEq(1.5));
+  ASSERT_THAT(rater.rate(7).target, Eq(0));
+  ASSERT_THAT(rater.rate(7).value, DoubleEq(1.5));
+  ASSERT_THAT(rater.rate(40).target, Eq(0));
+  ASSERT_THAT(rater.rate(40).value, DoubleEq(1));
+}
+
+TEST_F(ARater, RecomputesCachedScoresOfHyperedgesChangedByContractions) {
+  hypergraph.reset(new Hypergraph(7, 4, HyperedgeIndexVector { 0, 2, 6, 9,  /*sentinel*/ 12 },
+                                  HyperedgeVector { 0, 2, 0, 1, 3, 4, 3, 4, 6, 2, 5, 6 }));
+  context.coarsening.max_allowed_node_weight = 3;
+  context.evolutionary.gamma = 0.5;
+  context.evolutionary.edge_frequency = { 0, 1, 2, 3 };
+  EdgeFrequencyRater rater(*hypergraph, context);
+  ASSERT_THAT(rater.rate(3).target, Eq(4));
+  ASSERT_THAT(rater.rate(3).value, DoubleEq(exp(-0.5) / 4 + exp(-1.0) / 3));
+
+  hypergraph->contract(4, 6);
+
+  ASSERT_THAT(rater.rate(3).target, Eq(4));
+  ASSERT_THAT(rater.rate(3).value, DoubleEq((exp(-0.5) / 4 + exp(-1.0) / 2) / 2));
+}
 }  // namespace kahypar
@@ -0,0 +1,80 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2018 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+******************************************************************************/
+
+#include <sstream>
+#include <utility>
+
+#include "gmock/gmock.h"
+
+#include "kahypar/utils/memory_tracker.h"
+#include "kahypar/utils/memory_tree.h"
+
+using ::testing::Eq;
+using ::testing::HasSubstr;
+using ::testing::Ne;
+
+namespace kahypar {
+TEST(AMemoryTreeNode, AccumulatesTheSizeOfItsChildren) {
+  MemoryTreeNode root("Root", 8);
+  MemoryTreeNode* child = root.addChild("Child", 16);
+  child->addChild("Grandchild", 32);
+  child->addSize(64);
+  root.addChild("Sibling");
+
+  ASSERT_THAT(root.size(), Eq(120));
+  ASSERT_THAT(child->size(), Eq(112));
+  ASSERT_THAT(root.children().size(), Eq(2));
+  ASSERT_THAT(root.child("Sibling"), Ne(nullptr));
+  ASSERT_THAT(root.child("Sibling")->size(), Eq(0));
+  ASSERT_THAT(root.child("Grandchild"), Eq(nullptr));
+}
+
+TEST(AMemoryTreeNode, PrintsItsChildrenIndented) {
+  MemoryTreeNode root("Root", 1024 * 1024);
+  root.addChild("Child", 1024 * 1024);
+
+  std::ostringstream oss;
+  oss << root;
+  ASSERT_THAT(oss.str(), HasSubstr("+ Root = 2.000 MB"));
+  ASSERT_THAT(oss.str(), HasSubstr("  + Child = 1.000 MB"));
+}
+
+TEST(TheMemoryTracker, StoresTheLargestSampleOfEachPhase) {
+  Context context;
+  MemoryTracker::instance().clear();
+
+  MemoryTracker::instance().update(context, Timepoint::coarsening, MemoryTreeNode("A", 100));
+  MemoryTracker::instance().update(context, Timepoint::coarsening, MemoryTreeNode("B", 50));
+  MemoryTracker::instance().update(context, Timepoint::local_search, MemoryTreeNode("C", 70));
+
+  context.type = ContextType::initial_partitioning;
+  MemoryTracker::instance().update(context, Timepoint::coarsening, MemoryTreeNode("D", 20));
+
+  ASSERT_THAT(MemoryTracker::instance().maxSample(Timepoint::coarsening), Eq(100));
+  ASSERT_THAT(MemoryTracker::instance().maxSample(Timepoint::local_search), Eq(70));
+  ASSERT_THAT(MemoryTracker::instance().maxSample(Timepoint::ip_coarsening), Eq(20));
+  ASSERT_THAT(MemoryTracker::instance().maxSample(), Eq(100));
+  ASSERT_THAT(MemoryTracker::instance().maxSampleTree()->name(), Eq("A"));
+
+  MemoryTracker::instance().clear();
+  ASSERT_THAT(MemoryTracker::instance().maxSample(), Eq(0));
+  ASSERT_THAT(MemoryTracker::instance().maxSampleTree(), Eq(nullptr));
+}
+}  // namespace kahypar
@@ -66,7 +66,8 @@ static inline Hypergraph createHypergraphFromMtx(const std::string& filename,
   ALWAYS_ASSERT(matrix.info.object == mtxconversion::MatrixObjectType::WEIGHTED_MATRIX
                 || matrix.data.weights.empty(), "Weights not allowed");
   return Hypergraph(num_hypernodes, num_hyperedges, index_vector, edge_vector,
-                    num_parts, HyperedgeWeightVector{ }, matrix.data.weights);
+                    num_parts, HyperedgeWeightVector{ },
+                    HypernodeWeightVector(matrix.data.weights.begin(), matrix.data.weights.end()));
 }
 
 int main(int argc, char* argv[]) {
@@ -0,0 +1,164 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <queue>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace kahypar {
+/*!
+ * Sorts a sequence of trivially copyable elements that does not fit into main
+ * memory. Elements are collected in a buffer of at most max_elements_in_memory
+ * elements. Full buffers are sorted and written to temporary files (runs),
+ * which are merged on the fly when the sorted sequence is requested.
+ */
+template <typename T, typename Compare = std::less<T> >
+class ExternalSorter {
+  static_assert(std::is_trivially_copyable<T>::value, "Elements are written to disk as raw bytes");
+
+ private:
+  struct Run {
+    std::FILE* file;
+    std::vector<T> buffer;
+    size_t pos;
+  };
+
+ public:
+  explicit ExternalSorter(const size_t max_elements_in_memory, const Compare& compare = Compare()) :
+    _max_elements_in_memory(std::max(max_elements_in_memory, static_cast<size_t>(1))),
+    _compare(compare),
+    _buffer(),
+    _runs(),
+    _size(0) { }
+
+  ExternalSorter(const ExternalSorter&) = delete;
+  ExternalSorter& operator= (const ExternalSorter&) = delete;
+
+  ExternalSorter(ExternalSorter&&) = delete;
+  ExternalSorter& operator= (ExternalSorter&&) = delete;
+
+  ~ExternalSorter() {
+    for (Run& run : _runs) {
+      std::fclose(run.file);
+    }
+  }
+
+  void push(const T& element) {
+    _buffer.push_back(element);
+    ++_size;
+    if (_buffer.size() == _max_elements_in_memory) {
+      writeRun();
+    }
+  }
+
+  size_t size() const {
+    return _size;
+  }
+
+  size_t numRuns() const {
+    return _runs.size();
+  }
+
+  // ! Calls f for all pushed elements in sorted order. Can only be called once.
+  template <typename F>
+  void forEachSorted(const F& f) {
+    if (_runs.empty()) {
+      std::sort(_buffer.begin(), _buffer.end(), _compare);
+      for (const T& element : _buffer) {
+        f(element);
+      }
+      std::vector<T>().swap(_buffer);
+      return;
+    }
+    if (!_buffer.empty()) {
+      writeRun();
+    }
+    std::vector<T>().swap(_buffer);
+
+    // k-way merge with a read buffer per run that shares the memory budget
+    const size_t buffer_size = std::max(_max_elements_in_memory / _runs.size(),
+                                        static_cast<size_t>(1));
+    const auto greater = [this](const std::pair<T, size_t>& lhs,
+                                const std::pair<T, size_t>& rhs) {
+                           return _compare(rhs.first, lhs.first);
+                         };
+    std::priority_queue<std::pair<T, size_t>, std::vector<std::pair<T, size_t> >,
+                        decltype(greater)> queue(greater);
+    T element;
+    for (size_t i = 0; i < _runs.size(); ++i) {
+      _runs[i].buffer.resize(buffer_size);
+      _runs[i].pos = _runs[i].buffer.size();
+      if (next(_runs[i], element)) {
+        queue.emplace(element, i);
+      }
+    }
+    while (!queue.empty()) {
+      const size_t run = queue.top().second;
+      f(queue.top().first);
+      queue.pop();
+      if (next(_runs[run], element)) {
+        queue.emplace(element, run);
+      }
+    }
+  }
+
+ private:
+  void writeRun() {
+    std::sort(_buffer.begin(), _buffer.end(), _compare);
+    std::FILE* file = std::tmpfile();
+    if (file == nullptr ||
+        std::fwrite(_buffer.data(), sizeof(T), _buffer.size(), file) != _buffer.size()) {
+      std::cerr << "Error: Could not write temporary file for external sorting" << std::endl;
+      exit(1);
+    }
+    std::rewind(file);
+    _runs.push_back(Run { file, { }, 0 });
+    _buffer.clear();
+  }
+
+  static bool next(Run& run, T& element) {
+    if (run.pos == run.buffer.size()) {
+      run.buffer.resize(run.buffer.capacity());
+      const size_t num_read = std::fread(run.buffer.data(), sizeof(T), run.buffer.size(), run.file);
+      run.buffer.resize(num_read);
+      run.pos = 0;
+      if (num_read == 0) {
+        return false;
+      }
+    }
+    element = run.buffer[run.pos++];
+    return true;
+  }
+
+  const size_t _max_elements_in_memory;
+  const Compare _compare;
+  std::vector<T> _buffer;
+  std::vector<Run> _runs;
+  size_t _size;
+};
+}  // namespace kahypar
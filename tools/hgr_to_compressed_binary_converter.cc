@@ -0,0 +1,53 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2018 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+******************************************************************************/
+
+
+#include <iostream>
+#include <string>
+
+#include "kahypar/definitions.h"
+#include "kahypar/io/binary_hypergraph_io.h"
+#include "kahypar/io/hypergraph_io.h"
+
+using namespace kahypar;
+
+int main(int argc, char* argv[]) {
+  if (argc != 3) {
+    std::cout << "No .hgr file specified" << std::endl;
+    std::cout << "Usage: HgrToCompressedBinary <.hgr> <outfile>" << std::endl;
+    exit(0);
+  }
+  std::string hgr_filename(argv[1]);
+  std::string out_filename(argv[2]);
+
+  std::cout << "Converting hypergraph " << hgr_filename
+            << " to binary hypergraph format with compressed pins: " << out_filename
+            << "..." << std::endl;
+
+  Hypergraph hypergraph(
+    io::createHypergraphFromFile(hgr_filename, 2));
+
+  io::writeBinaryHypergraphFile(hypergraph, out_filename, nullptr, true);
+
+  std::cout << "Stored " << hypergraph.initialNumPins() << " pins in "
+            << io::MemoryMappedFile(out_filename).size() << " bytes" << std::endl;
+
+  return 0;
+}
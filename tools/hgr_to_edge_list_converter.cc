@@ -23,27 +23,25 @@
 #include <sstream>
 #include <string>
 
-#include "kahypar/io/hypergraph_io.h"
 #include "kahypar/macros.h"
-#include "tools/hgr_to_edgelist_conversion.h"
+#include "tools/streaming_conversion.h"
 
 using namespace kahypar;
 
 int main(int argc, char* argv[]) {
-  if (argc != 2) {
+  if (argc < 2 || argc > 3) {
     std::cout << "No .hgr file specified" << std::endl;
+    std::cout << "Usage: HgrToEdgeList <.hgr> [memory limit in MiB]" << std::endl;
+    exit(0);
   }
   std::string hgr_filename(argv[1]);
   std::string graphml_filename(hgr_filename + ".edgelist");
+  const size_t max_entries_in_memory = argc > 2 ?
+                                       std::stoull(argv[2]) * (1 << 20) / sizeof(streaming::Entry) :
+                                       streaming::kDefaultMaxEntriesInMemory;
 
-  EdgeVector edges = createEdgeVector(kahypar::io::createHypergraphFromFile(hgr_filename, 2));
+  streaming::convertHgrToEdgeList(hgr_filename, graphml_filename, max_entries_in_memory);
 
-  std::ofstream out_stream(graphml_filename.c_str());
-  for (const Edge& edge : edges) {
-    out_stream << edge.src << " " << edge.dest << std::endl;
-  }
-
-  out_stream.close();
   std::cout << "done" << std::endl;
   return 0;
 }
@@ -22,9 +22,8 @@
 #include <string>
 
 #include "kahypar/definitions.h"
-#include "kahypar/io/hypergraph_io.h"
 #include "kahypar/macros.h"
-#include "tools/hgr_to_mtx_conversion.h"
+#include "tools/streaming_conversion.h"
 
 using namespace kahypar;
 
@@ -39,8 +38,7 @@ int main(int argc, char* argv[]) {
   const std::string out_filename(argv[2]);
   LOG << "Converting hypergraph " << hypergraph_filename << "to mtx format:"
       << out_filename << "...";
-  Hypergraph hypergraph(io::createHypergraphFromFile(hypergraph_filename, 2));
-  kahypar::writeHypergraphInMatrixMarketFormat(hypergraph, out_filename);
+  streaming::convertHgrToMtx(hypergraph_filename, out_filename);
   LOG << "... done!";
   return 0;
 }
@@ -24,8 +24,8 @@
 #include <string>
 
 #include "kahypar/definitions.h"
-#include "kahypar/io/hypergraph_io.h"
 #include "kahypar/macros.h"
+#include "tools/streaming_conversion.h"
 
 using namespace kahypar;
 
@@ -41,10 +41,7 @@ int main(int argc, char* argv[]) {
   std::cout << "Converting graph " << hgr_filename << " to HGR hypergraph format: "
             << out_filename << "..." << std::endl;
 
-  Hypergraph hypergraph(
-    io::createHypergraphFromFile(hgr_filename, 2));
-
-  io::writeHypergraphForPaToHPartitioning(hypergraph, out_filename);
+  streaming::convertHgrToPaToH(hgr_filename, out_filename);
 
   return 0;
 }
@@ -22,10 +22,11 @@
 #include <iostream>
 #include <map>
 #include <string>
+#include <vector>
 
 #include "kahypar/definitions.h"
 #include "kahypar/io/hypergraph_io.h"
-#include "kahypar/partition/metrics.h"
+#include "kahypar/io/hypergraph_statistics.h"
 
 using namespace kahypar;
 
@@ -47,17 +48,24 @@ int main(int argc, char* argv[]) {
 
   kahypar::io::readHypergraphFile(graph_filename, num_hypernodes, num_hyperedges,
                                   index_vector, edge_vector, &hyperedge_weights, &hypernode_weights);
-  Hypergraph hypergraph(num_hypernodes, num_hyperedges, index_vector, edge_vector);
+  kahypar::io::exitIfInvalid(kahypar::io::validateHypergraph(num_hypernodes, num_hyperedges,
+                                                             index_vector, edge_vector),
+                             graph_filename);
 
+  std::vector<HyperedgeID> degrees(num_hypernodes, 0);
   std::map<HyperedgeID, HyperedgeID> node_degrees;
   std::map<HypernodeID, HypernodeID> edge_sizes;
 
-  for (const auto& hn : hypergraph.nodes()) {
-    ++node_degrees[hypergraph.nodeDegree(hn)];
+  for (HyperedgeID he = 0; he < num_hyperedges; ++he) {
+    ++edge_sizes[index_vector[he + 1] - index_vector[he]];
   }
 
-  for (const auto& he : hypergraph.edges()) {
-    ++edge_sizes[hypergraph.edgeSize(he)];
+  for (const HypernodeID& pin : edge_vector) {
+    ++degrees[pin];
+  }
+
+  for (const HyperedgeID& degree : degrees) {
+    ++node_degrees[degree];
   }
 
   std::string graph_name = graph_filename.substr(graph_filename.find_last_of("/") + 1);
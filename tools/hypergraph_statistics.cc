@@ -25,9 +25,7 @@
 
 #include "kahypar/definitions.h"
 #include "kahypar/io/hypergraph_io.h"
-#include "kahypar/io/partitioning_output.h"
-#include "kahypar/partition/metrics.h"
-#include "kahypar/utils/math.h"
+#include "kahypar/io/hypergraph_statistics.h"
 
 using namespace kahypar;
 
@@ -49,129 +47,64 @@ int main(int argc, char* argv[]) {
 
   kahypar::io::readHypergraphFile(graph_filename, num_hypernodes, num_hyperedges,
                                   index_vector, edge_vector, &hyperedge_weights, &hypernode_weights);
-  Hypergraph hypergraph(num_hypernodes, num_hyperedges, index_vector, edge_vector, 2, hyperedge_weights, hypernode_weights);
-
-  HyperedgeID max_hn_degree = 0;
-  HyperedgeID min_hn_degree = std::numeric_limits<HyperedgeID>::max();
-  double avg_hn_degree = kahypar::metrics::avgHypernodeDegree(hypergraph);
-  double sd_hn_degree = 0.0;
-  std::vector<HyperedgeID> hn_degrees;
-  hn_degrees.reserve(hypergraph.currentNumNodes());
-  for (const auto& hn : hypergraph.nodes()) {
-    hn_degrees.push_back(hypergraph.nodeDegree(hn));
-    max_hn_degree = std::max(max_hn_degree, hypergraph.nodeDegree(hn));
-    min_hn_degree = std::min(min_hn_degree, hypergraph.nodeDegree(hn));
-    sd_hn_degree += std::pow(hypergraph.nodeDegree(hn), 2);
-  }
-
-  sd_hn_degree = std::sqrt((sd_hn_degree / num_hypernodes) - std::pow(avg_hn_degree, 2));
-
-  std::string graph_name = graph_filename.substr(graph_filename.find_last_of("/") + 1);
-  std::ofstream out_stream(stats_filename.c_str(), std::ofstream::app);
-
-  HyperedgeID num_single_node_hes = 0;
-  HypernodeID max_he_size = 0;
-  HypernodeID min_he_size = std::numeric_limits<HypernodeID>::max();
-  double avg_he_size = kahypar::metrics::avgHyperedgeDegree(hypergraph);
-  double sd_he_size = 0.0;
-  std::vector<HypernodeID> he_sizes;
-  he_sizes.reserve(hypergraph.currentNumEdges());
-  for (const auto& he : hypergraph.edges()) {
-    if (hypergraph.edgeSize(he) == 1) {
-      ++num_single_node_hes;
-    }
-    he_sizes.push_back(hypergraph.edgeSize(he));
-    max_he_size = std::max(max_he_size, hypergraph.edgeSize(he));
-    min_he_size = std::min(min_he_size, hypergraph.edgeSize(he));
-    sd_he_size += std::pow(hypergraph.edgeSize(he), 2);
-  }
-
-  sd_he_size = std::sqrt((sd_he_size / num_hyperedges) - std::pow(avg_he_size, 2));
-
-  std::sort(he_sizes.begin(), he_sizes.end());
-  std::sort(hn_degrees.begin(), hn_degrees.end());
-
-  auto he_size_quartiles = kahypar::math::firstAndThirdQuartile(he_sizes);
-  auto hn_deg_quartiles = kahypar::math::firstAndThirdQuartile(hn_degrees);
+  const kahypar::io::HypergraphStats stats =
+    kahypar::io::validateHypergraph(num_hypernodes, num_hyperedges, index_vector, edge_vector,
+                                    &hyperedge_weights, &hypernode_weights);
+  kahypar::io::exitIfInvalid(stats, graph_filename);
 
+  // the statistics use the sample standard deviation, this tool reports the population one
+  const auto population_sd = [](const kahypar::io::Distribution& distribution,
+                                const size_t size) {
+                               return distribution.sd * std::sqrt((size - 1.0) / size);
+                             };
 
   double density = 0;
-  for (const auto he : hypergraph.edges()) {
-    density += hypergraph.edgeSize(he) * (hypergraph.edgeSize(he) - 1);
+  for (HyperedgeID he = 0; he < num_hyperedges; ++he) {
+    const double edge_size = index_vector[he + 1] - index_vector[he];
+    density += edge_size * (edge_size - 1);
   }
-  density = density / (num_hypernodes * (num_hypernodes - 1));
-
-  HyperedgeWeight min_he_weight = std::numeric_limits<HyperedgeWeight>::max();
-  HyperedgeWeight max_he_weight = 0;
-  HypernodeWeight total_he_weight = 0;
-  double sd_he_weight = 0.0;
-  std::vector<HyperedgeWeight> he_weights;
-  he_weights.reserve(hypergraph.currentNumEdges());
-  for (const auto& he : hypergraph.edges()) {
-    min_he_weight = std::min(min_he_weight, hypergraph.edgeWeight(he));
-    max_he_weight = std::max(max_he_weight, hypergraph.edgeWeight(he));
-    total_he_weight += hypergraph.edgeWeight(he);
-    sd_he_weight += std::pow(hypergraph.edgeWeight(he), 2);
-    he_weights.push_back(hypergraph.edgeWeight(he));
-  }
-  double avg_he_weight = static_cast<double>(total_he_weight) / num_hyperedges;
-  sd_he_weight = std::sqrt((sd_he_weight / num_hyperedges) - std::pow(avg_he_weight, 2));
-
-  std::sort(he_weights.begin(), he_weights.end());
-  auto he_weight_quartiles = kahypar::math::firstAndThirdQuartile(he_weights);
+  density = density / (num_hypernodes * (num_hypernodes - 1.0));
 
-  HypernodeWeight min_hn_weight = std::numeric_limits<HypernodeWeight>::max();
-  double avg_hn_weight = kahypar::metrics::avgHypernodeWeight(hypergraph);
-  double sd_hn_weight = 0.0;
-  std::vector<HypernodeWeight> hn_weights;
-  hn_weights.reserve(hypergraph.currentNumNodes());
-  for (const auto& hn : hypergraph.nodes()) {
-    min_hn_weight = std::min(min_hn_weight, hypergraph.nodeWeight(hn));
-    sd_hn_weight += std::pow(hypergraph.nodeWeight(hn), 2);
-    hn_weights.push_back(hypergraph.nodeWeight(hn));
-  }
-  sd_hn_weight = std::sqrt((sd_hn_weight / num_hypernodes) - std::pow(avg_hn_weight, 2));
-
-  std::sort(hn_weights.begin(), hn_weights.end());
-  auto hn_weight_quartiles = kahypar::math::firstAndThirdQuartile(hn_weights);
+  std::string graph_name = graph_filename.substr(graph_filename.find_last_of("/") + 1);
+  std::ofstream out_stream(stats_filename.c_str(), std::ofstream::app);
 
   out_stream << "RESULT graph=" << graph_name
              << " HNs=" << num_hypernodes
              << " HEs=" << num_hyperedges
              << " pins=" << edge_vector.size()
-             << " numSingleNodeHEs=" << num_single_node_hes
-             << " avgHEsize=" << avg_he_size
-             << " sdHEsize=" << sd_he_size
-             << " minHEsize=" << min_he_size
-             << " heSize90thPercentile=" << kahypar::metrics::hyperedgeSizePercentile(hypergraph, 90)
-             << " Q1HEsize=" << he_size_quartiles.first
-             << " medHEsize=" << kahypar::math::median(he_sizes)
-             << " Q3HEsize=" << he_size_quartiles.second
-             << " maxHEsize=" << max_he_size
-             << " totalHEweight=" << total_he_weight
-             << " avgHEweight=" << avg_he_weight
-             << " sdHEweight=" << sd_he_weight
-             << " minHEweight=" << min_he_weight
-             << " Q1HEweight=" << he_weight_quartiles.first
-             << " medHEweight=" << kahypar::math::median(he_weights)
-             << " Q3HEweight=" << he_weight_quartiles.second
-             << " maxHEweight=" << max_he_weight
-             << " avgHNdegree=" << avg_hn_degree
-             << " sdHNdegree=" << sd_hn_degree
-             << " minHnDegree=" << min_hn_degree
-             << " hnDegree90thPercentile=" << kahypar::metrics::hypernodeDegreePercentile(hypergraph, 90)
-             << " maxHnDegree=" << max_hn_degree
-             << " Q1HNdegree=" << hn_deg_quartiles.first
-             << " medHNdegree=" << kahypar::math::median(hn_degrees)
-             << " Q3HNdegree=" << hn_deg_quartiles.second
-             << " totalHNweight=" << hypergraph.totalWeight()
-             << " avgHNweight=" << avg_hn_weight
-             << " sdHNweight=" << sd_hn_weight
-             << " minHNweight=" << min_hn_weight
-             << " Q1HNweight=" << hn_weight_quartiles.first
-             << " medHNweight=" << kahypar::math::median(hn_weights)
-             << " Q3HNweight=" << hn_weight_quartiles.second
-             << " maxHNweight=" << hypergraph.weightOfHeaviestNode()
+             << " numSingleNodeHEs=" << stats.num_single_pin_hyperedges
+             << " avgHEsize=" << stats.he_size.avg
+             << " sdHEsize=" << population_sd(stats.he_size, num_hyperedges)
+             << " minHEsize=" << stats.he_size.min
+             << " heSize90thPercentile=" << stats.he_size.p90
+             << " Q1HEsize=" << stats.he_size.q1
+             << " medHEsize=" << stats.he_size.med
+             << " Q3HEsize=" << stats.he_size.q3
+             << " maxHEsize=" << stats.he_size.max
+             << " totalHEweight=" << stats.he_weight.sum
+             << " avgHEweight=" << stats.he_weight.avg
+             << " sdHEweight=" << population_sd(stats.he_weight, num_hyperedges)
+             << " minHEweight=" << stats.he_weight.min
+             << " Q1HEweight=" << stats.he_weight.q1
+             << " medHEweight=" << stats.he_weight.med
+             << " Q3HEweight=" << stats.he_weight.q3
+             << " maxHEweight=" << stats.he_weight.max
+             << " avgHNdegree=" << stats.hn_degree.avg
+             << " sdHNdegree=" << population_sd(stats.hn_degree, num_hypernodes)
+             << " minHnDegree=" << stats.hn_degree.min
+             << " hnDegree90thPercentile=" << stats.hn_degree.p90
+             << " maxHnDegree=" << stats.hn_degree.max
+             << " Q1HNdegree=" << stats.hn_degree.q1
+             << " medHNdegree=" << stats.hn_degree.med
+             << " Q3HNdegree=" << stats.hn_degree.q3
+             << " totalHNweight=" << stats.hn_weight.sum
+             << " avgHNweight=" << stats.hn_weight.avg
+             << " sdHNweight=" << population_sd(stats.hn_weight, num_hypernodes)
+             << " minHNweight=" << stats.hn_weight.min
+             << " Q1HNweight=" << stats.hn_weight.q1
+             << " medHNweight=" << stats.hn_weight.med
+             << " Q3HNweight=" << stats.hn_weight.q3
+             << " maxHNweight=" << stats.hn_weight.max
              << " density=" << static_cast<double>(num_hyperedges) / num_hypernodes
              << " true_density=" << density
              << std::endl;
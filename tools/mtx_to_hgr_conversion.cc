@@ -30,6 +30,10 @@ static constexpr bool debug = false;
 MatrixInfo parseHeader(std::ifstream& file) {
   std::string line;
   std::getline(file, line);
+  return parseHeaderLine(line);
+}
+
+MatrixInfo parseHeaderLine(const std::string& line) {
   std::istringstream sstream(line);
   std::string matrix_market, object, matrix_format, data_format, symmetry;
   sstream >> matrix_market >> object >> matrix_format >> data_format >> symmetry;
@@ -103,7 +107,7 @@ void parseCoordinateMatrixEntries(std::ifstream& file, MatrixInfo& info,
   std::string line;
   int row = -1;
   int column = -1;
-  for (int i = 0; i < info.num_entries; ++i) {
+  for (int64_t i = 0; i < info.num_entries; ++i) {
     std::getline(file, line);
     DBG << line;
     std::istringstream line_stream(line);
@@ -230,7 +234,7 @@ void convertMtxToHgrForNonsymmetricParallelSPM(const std::string& matrix_filenam
   std::string line;
   int row = -1;
   int column = -1;
-  for (int i = 0; i < matrix.info.num_entries; ++i) {
+  for (int64_t i = 0; i < matrix.info.num_entries; ++i) {
     std::getline(mtx_file, line);
     DBG << line;
     std::istringstream line_stream(line);
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <fstream>
 #include <string>
 #include <vector>
@@ -35,7 +36,7 @@ struct MatrixInfo {
   MatrixSymmetry symmetry = MatrixSymmetry::GENERAL;
   int num_rows = 0;
   int num_columns = 0;
-  int num_entries = 0;
+  int64_t num_entries = 0;
 };
 
 struct MatrixData {
@@ -53,6 +54,7 @@ struct Matrix {
 };
 
 MatrixInfo parseHeader(std::ifstream& file);
+MatrixInfo parseHeaderLine(const std::string& line);
 void parseDimensionInformation(std::ifstream& file, MatrixInfo& info);
 void parseMatrixEntries(std::ifstream& file, MatrixInfo& info, MatrixData& matrix_data);
 void parseCoordinateMatrixEntries(std::ifstream& file, MatrixInfo& info, MatrixData& matrix_data);
@@ -22,17 +22,26 @@
 #include <string>
 
 #include "kahypar/macros.h"
-#include "tools/mtx_to_hgr_conversion.h"
+#include "tools/streaming_conversion.h"
+
+using namespace kahypar;
 
 int main(int argc, char* argv[]) {
-  if (argc != 2) {
+  if (argc < 2 || argc > 4) {
     std::cout << "No .mtx file specified" << std::endl;
+    std::cout << "Usage: MtxToHgr <.mtx> [row-net|column-net] [memory limit in MiB]" << std::endl;
+    exit(0);
   }
   std::string mtx_filename(argv[1]);
   std::string hgr_filename(mtx_filename + ".hgr");
+  const MatrixModel model = argc > 2 && std::string(argv[2]) == "column-net" ?
+                            MatrixModel::column_net : MatrixModel::row_net;
+  const size_t max_entries_in_memory = argc > 3 ?
+                                       std::stoull(argv[3]) * (1 << 20) / sizeof(streaming::Entry) :
+                                       streaming::kDefaultMaxEntriesInMemory;
   std::cout << "Converting MTX matrix " << mtx_filename << " to HGR hypergraph format: "
             << hgr_filename << "..." << std::endl;
-  mtxconversion::convertMtxToHgr(mtx_filename, hgr_filename);
+  streaming::convertMtxToHgr(mtx_filename, hgr_filename, model, max_entries_in_memory);
   std::cout << " ... done!" << std::endl;
   return 0;
 }
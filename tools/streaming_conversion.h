@@ -0,0 +1,380 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "kahypar/definitions.h"
+#include "kahypar/io/hypergraph_io.h"
+#include "tools/external_sort.h"
+#include "tools/mtx_to_hgr_conversion.h"
+
+// ! \addtogroup tools
+// ! \{
+
+/*!
+ * Conversion routines that never materialize the whole input in memory.
+ * Input files are processed line by line (via memory mapping or block-wise
+ * decompression) and the output is written incrementally. Conversions that
+ * have to transpose the input sort their entries with an ExternalSorter.
+ */
+namespace kahypar {
+namespace streaming {
+// ! Default number of entries that are sorted in memory before they are spilled to disk
+static constexpr size_t kDefaultMaxEntriesInMemory = static_cast<size_t>(1) << 27;
+
+// ! Pin of a hypergraph in the order in which it is written
+struct Entry {
+  uint64_t first;
+  uint64_t second;
+
+  friend bool operator< (const Entry& lhs, const Entry& rhs) {
+    return lhs.first < rhs.first || (lhs.first == rhs.first && lhs.second < rhs.second);
+  }
+};
+
+/*!
+ * Calls on_header(num_hyperedges, num_hypernodes, type) for the header of the
+ * hMetis file, on_hyperedge(he, weight, pins) for each hyperedge (with pins
+ * starting at 0) and on_hypernode_weight(hn, weight) for each hypernode weight.
+ */
+template <typename OnHeader, typename OnHyperedge, typename OnHypernodeWeight>
+static inline void forEachLineOfHgrFile(const std::string& filename, const OnHeader& on_header,
+                                        const OnHyperedge& on_hyperedge,
+                                        const OnHypernodeWeight& on_hypernode_weight) {
+  bool header_read = false;
+  HyperedgeID num_hyperedges = 0;
+  HypernodeID num_hypernodes = 0;
+  bool has_hyperedge_weights = false;
+  bool has_hypernode_weights = false;
+  uint64_t line_index = 0;
+  std::vector<HypernodeID> pins;
+  const bool file_found = io::forEachBlockOfLines(filename, [&](const char* begin,
+                                                                const char* end) {
+      for (const char* line = begin; line != end; line = io::internal::nextLine(line, end)) {
+        const char* eol = io::internal::endOfLine(line, end);
+        if (io::internal::isCommentLine(line, eol)) {
+          continue;
+        }
+        const char* pos = line;
+        if (!header_read) {
+          int type = 0;
+          io::internal::scanInteger(pos, eol, num_hyperedges);
+          io::internal::scanInteger(pos, eol, num_hypernodes);
+          io::internal::scanInteger(pos, eol, type);
+          const HypergraphType hypergraph_type = static_cast<HypergraphType>(type);
+          has_hyperedge_weights = hypergraph_type == HypergraphType::EdgeWeights ||
+                                  hypergraph_type == HypergraphType::EdgeAndNodeWeights;
+          has_hypernode_weights = hypergraph_type == HypergraphType::NodeWeights ||
+                                  hypergraph_type == HypergraphType::EdgeAndNodeWeights;
+          on_header(num_hyperedges, num_hypernodes, hypergraph_type);
+          header_read = true;
+        } else if (line_index < num_hyperedges) {
+          HyperedgeWeight weight = 1;
+          if (has_hyperedge_weights) {
+            io::internal::scanInteger(pos, eol, weight);
+          }
+          pins.clear();
+          HypernodeID pin = 0;
+          while (io::internal::scanInteger(pos, eol, pin)) {
+            pins.push_back(pin - 1);
+          }
+          if (pins.empty()) {
+            std::cerr << "Error: Hyperedge " << line_index << " is empty" << std::endl;
+            exit(1);
+          }
+          on_hyperedge(static_cast<HyperedgeID>(line_index), weight, pins);
+          ++line_index;
+        } else if (has_hypernode_weights && line_index < num_hyperedges + num_hypernodes) {
+          HypernodeWeight weight = 1;
+          io::internal::scanInteger(pos, eol, weight);
+          on_hypernode_weight(static_cast<HypernodeID>(line_index - num_hyperedges), weight);
+          ++line_index;
+        }
+      }
+      return true;
+    });
+  if (!file_found) {
+    std::cerr << "Error: File not found: " << filename << std::endl;
+    exit(1);
+  }
+  if (line_index < num_hyperedges) {
+    std::cerr << "Error: Hyperedge " << line_index << " is empty" << std::endl;
+    exit(1);
+  }
+}
+
+// ! Returns the number of pins of an hMetis file without storing the hypergraph
+static inline uint64_t countPins(const std::string& hgr_filename) {
+  uint64_t num_pins = 0;
+  forEachLineOfHgrFile(hgr_filename,
+                       [](const HyperedgeID, const HypernodeID, const HypergraphType) { },
+                       [&](const HyperedgeID, const HyperedgeWeight,
+                           const std::vector<HypernodeID>& pins) {
+        num_pins += pins.size();
+      },
+                       [](const HypernodeID, const HypernodeWeight) { });
+  return num_pins;
+}
+
+// ! Streaming version of io::writeHypergraphForPaToHPartitioning
+static inline void convertHgrToPaToH(const std::string& hgr_filename,
+                                     const std::string& out_filename) {
+  const uint64_t num_pins = countPins(hgr_filename);
+  std::ofstream out_stream(out_filename.c_str());
+  HypernodeID num_hypernodes = 0;
+  bool has_hypernode_weights = false;
+  forEachLineOfHgrFile(hgr_filename,
+                       [&](const HyperedgeID num_hyperedges, const HypernodeID n,
+                           const HypergraphType type) {
+        num_hypernodes = n;
+        has_hypernode_weights = type == HypergraphType::NodeWeights ||
+                                type == HypergraphType::EdgeAndNodeWeights;
+        out_stream << 0;                     // 0-based indexing
+        out_stream << " " << num_hypernodes << " " << num_hyperedges << " " << num_pins;
+        out_stream << " " << 3 << "\n";      // weighting scheme: both edge and node weights
+      },
+                       [&](const HyperedgeID, const HyperedgeWeight weight,
+                           const std::vector<HypernodeID>& pins) {
+        out_stream << weight << " ";
+        for (const HypernodeID& pin : pins) {
+          out_stream << pin << " ";
+        }
+        out_stream << "\n";
+      },
+                       [&](const HypernodeID, const HypernodeWeight weight) {
+        out_stream << weight << " ";
+      });
+  if (!has_hypernode_weights) {
+    for (HypernodeID hn = 0; hn < num_hypernodes; ++hn) {
+      out_stream << 1 << " ";
+    }
+  }
+  out_stream << std::endl;
+  out_stream.close();
+}
+
+// ! Streaming version of writeHypergraphInMatrixMarketFormat
+static inline void convertHgrToMtx(const std::string& hgr_filename,
+                                   const std::string& out_filename) {
+  const uint64_t num_pins = countPins(hgr_filename);
+  std::ofstream out_stream(out_filename.c_str());
+  HypernodeID num_hypernodes = 0;
+  bool has_hypernode_weights = false;
+  forEachLineOfHgrFile(hgr_filename,
+                       [&](const HyperedgeID num_hyperedges, const HypernodeID n,
+                           const HypergraphType type) {
+        num_hypernodes = n;
+        has_hypernode_weights = type == HypergraphType::NodeWeights ||
+                                type == HypergraphType::EdgeAndNodeWeights;
+        out_stream << "%%MatrixMarket weightedmatrix coordinate pattern general" << "\n";
+        out_stream << num_hyperedges << " " << num_hypernodes << " " << num_pins << " "
+                   << "2" << "\n";
+      },
+                       [&](const HyperedgeID he, const HyperedgeWeight,
+                           const std::vector<HypernodeID>& pins) {
+        for (const HypernodeID& pin : pins) {
+          out_stream << (he + 1) << " " << (pin + 1) << "\n";
+        }
+      },
+                       [&](const HypernodeID, const HypernodeWeight weight) {
+        out_stream << weight << "\n";
+      });
+  if (!has_hypernode_weights) {
+    for (HypernodeID hn = 0; hn < num_hypernodes; ++hn) {
+      out_stream << 1 << "\n";
+    }
+  }
+  out_stream.close();
+}
+
+/*!
+ * Streaming version of createEdgeVector: Writes the edge list of the bipartite
+ * graph ordered by hypernode vertices. Since hMetis files are ordered by
+ * hyperedges, the edges are transposed via external sorting.
+ */
+static inline void convertHgrToEdgeList(const std::string& hgr_filename,
+                                        const std::string& out_filename,
+                                        const size_t max_entries_in_memory =
+                                          kDefaultMaxEntriesInMemory) {
+  ExternalSorter<Entry> sorter(max_entries_in_memory);
+  HypernodeID num_hypernodes = 0;
+  forEachLineOfHgrFile(hgr_filename,
+                       [&](const HyperedgeID, const HypernodeID n, const HypergraphType) {
+        num_hypernodes = n;
+      },
+                       [&](const HyperedgeID he, const HyperedgeWeight,
+                           const std::vector<HypernodeID>& pins) {
+        for (const HypernodeID& pin : pins) {
+          sorter.push(Entry { pin, he });
+        }
+      },
+                       [](const HypernodeID, const HypernodeWeight) { });
+
+  std::ofstream out_stream(out_filename.c_str());
+  sorter.forEachSorted([&](const Entry& entry) {
+      // Hypernode-vertex IDs start with 0
+      // Hyperedge-vertex IDs start with |V|
+      out_stream << entry.first << " " << num_hypernodes + entry.second << "\n";
+    });
+  out_stream.close();
+}
+
+/*!
+ * Streaming version of mtxconversion::convertMtxToHgr. In the row-net model,
+ * each row is a hyperedge that contains the columns of its nonzeros, in the
+ * column-net model each column is a hyperedge that contains the rows of its
+ * nonzeros. Nonzeros are grouped by their hyperedge via external sorting,
+ * such that only O(#rows + #columns) memory is required in addition to the
+ * in-memory sorting buffer. Empty hyperedges are removed.
+ */
+static inline void convertMtxToHgr(const std::string& mtx_filename,
+                                   const std::string& hgr_filename,
+                                   const MatrixModel model = MatrixModel::row_net,
+                                   const size_t max_entries_in_memory =
+                                     kDefaultMaxEntriesInMemory) {
+  using mtxconversion::MatrixInfo;
+  using mtxconversion::MatrixObjectType;
+  using mtxconversion::MatrixSymmetry;
+
+  if (model == MatrixModel::fine_grain) {
+    std::cerr << "Error: The fine-grain model is not supported for streaming conversion"
+              << std::endl;
+    exit(1);
+  }
+  MatrixInfo info;
+  bool header_read = false;
+  bool dimensions_read = false;
+  int64_t num_read_entries = 0;
+  std::vector<int> weights;
+  std::vector<bool> non_empty_hyperedges;
+  ExternalSorter<Entry> sorter(max_entries_in_memory);
+  const auto add_nonzero = [&](const uint64_t row, const uint64_t column) {
+                             const Entry entry = model == MatrixModel::row_net ?
+                                                 Entry { row, column } : Entry { column, row };
+                             non_empty_hyperedges[entry.first] = true;
+                             sorter.push(entry);
+                           };
+
+  const bool file_found = io::forEachBlockOfLines(mtx_filename, [&](const char* begin,
+                                                                    const char* end) {
+      for (const char* line = begin; line != end; line = io::internal::nextLine(line, end)) {
+        const char* eol = io::internal::endOfLine(line, end);
+        const char* pos = line;
+        if (!header_read) {
+          info = mtxconversion::parseHeaderLine(std::string(line, eol));
+          if (model == MatrixModel::column_net &&
+              info.object == MatrixObjectType::WEIGHTED_MATRIX) {
+            std::cerr << "Error: Weighted matrices are only supported for the row-net model"
+                      << std::endl;
+            exit(1);
+          }
+          header_read = true;
+        } else if (io::internal::isCommentLine(line, eol)) {
+          continue;
+        } else if (!dimensions_read) {
+          io::internal::scanInteger(pos, eol, info.num_rows);
+          io::internal::scanInteger(pos, eol, info.num_columns);
+          io::internal::scanInteger(pos, eol, info.num_entries);
+          non_empty_hyperedges.resize(model == MatrixModel::row_net ?
+                                      info.num_rows : info.num_columns);
+          dimensions_read = true;
+        } else if (num_read_entries < info.num_entries) {
+          uint64_t row = 0;
+          uint64_t column = 0;
+          const bool symmetric = info.symmetry == MatrixSymmetry::SYMMETRIC;
+          // indices start at 1 and mirrored entries of symmetric matrices have to fit as well
+          if (!io::internal::scanInteger(pos, eol, row) ||
+              !io::internal::scanInteger(pos, eol, column) ||
+              row == 0 || row > static_cast<uint64_t>(info.num_rows) ||
+              column == 0 || column > static_cast<uint64_t>(info.num_columns) ||
+              (symmetric && (row > static_cast<uint64_t>(info.num_columns) ||
+                             column > static_cast<uint64_t>(info.num_rows)))) {
+            std::cerr << "Error: Entry " << num_read_entries + 1
+                      << " of MatrixMarket file is invalid" << std::endl;
+            exit(1);
+          }
+          add_nonzero(row - 1, column - 1);
+          if (symmetric && row != column) {
+            add_nonzero(column - 1, row - 1);
+          }
+          ++num_read_entries;
+        } else if (info.object == MatrixObjectType::WEIGHTED_MATRIX &&
+                   weights.size() < static_cast<size_t>(info.num_columns)) {
+          int weight = 0;
+          io::internal::scanInteger(pos, eol, weight);
+          weights.push_back(weight);
+        }
+      }
+      return true;
+    });
+  if (!file_found) {
+    std::cerr << "Error: File not found: " << mtx_filename << std::endl;
+    exit(1);
+  }
+
+  uint64_t num_hyperedges = 0;
+  for (const bool non_empty : non_empty_hyperedges) {
+    num_hyperedges += non_empty;
+  }
+  if (num_hyperedges < non_empty_hyperedges.size()) {
+    std::cout << "WARNING: matrix contains " << non_empty_hyperedges.size() - num_hyperedges
+              << " empty hyperedges" << std::endl;
+    std::cout << "Number of hyperedges in hypergraph will be adjusted!" << std::endl;
+  }
+  std::vector<bool>().swap(non_empty_hyperedges);
+
+  const bool weighted = info.object == MatrixObjectType::WEIGHTED_MATRIX;
+  std::ofstream out_stream(hgr_filename.c_str());
+  out_stream << num_hyperedges << " "
+             << (model == MatrixModel::row_net ? info.num_columns : info.num_rows);
+  if (weighted) {
+    out_stream << " 10";
+  }
+  out_stream << "\n";
+  bool first_entry = true;
+  uint64_t current_hyperedge = 0;
+  sorter.forEachSorted([&](const Entry& entry) {
+      if (!first_entry) {
+        out_stream << (entry.first == current_hyperedge ? " " : "\n");
+      }
+      // ids start at 1
+      out_stream << entry.second + 1;
+      current_hyperedge = entry.first;
+      first_entry = false;
+    });
+  if (!first_entry) {
+    out_stream << "\n";
+  }
+  for (const int weight : weights) {
+    out_stream << weight << "\n";
+  }
+  out_stream.close();
+}
+}  // namespace streaming
+}  // namespace kahypar
+
+// ! \}
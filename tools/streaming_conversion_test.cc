@@ -0,0 +1,136 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "kahypar/definitions.h"
+#include "kahypar/io/hypergraph_io.h"
+#include "tools/external_sort.h"
+#include "tools/hgr_to_edgelist_conversion.h"
+#include "tools/hgr_to_mtx_conversion.h"
+#include "tools/mtx_to_hgr_conversion.h"
+#include "tools/streaming_conversion.h"
+
+using ::testing::ContainerEq;
+using ::testing::Eq;
+
+namespace kahypar {
+namespace streaming {
+static std::string readFile(const std::string& filename) {
+  std::ifstream file(filename);
+  std::stringstream content;
+  content << file.rdbuf();
+  return content.str();
+}
+
+TEST(AnExternalSorter, SortsElementsThatExceedTheMemoryLimit) {
+  std::vector<int> elements;
+  ExternalSorter<int> sorter(10);
+  for (int i = 0; i < 1000; ++i) {
+    elements.push_back((i * 7919) % 1009);
+    sorter.push(elements.back());
+  }
+  ASSERT_THAT(sorter.numRuns(), Eq(100));
+
+  std::vector<int> sorted;
+  sorter.forEachSorted([&](const int element) {
+      sorted.push_back(element);
+    });
+  std::sort(elements.begin(), elements.end());
+  ASSERT_THAT(sorted, ContainerEq(elements));
+}
+
+TEST(AStreamingConverter, WritesTheSamePaToHFileAsTheInMemoryConversion) {
+  for (const std::string filename : { "test_instances/mondriaan_example.hgr",
+                                      "test_instances/WeightedMtxExampleCorrect.hgr" }) {
+    const Hypergraph hypergraph = io::createHypergraphFromFile(filename, 2);
+    io::writeHypergraphForPaToHPartitioning(hypergraph, filename + ".expected.patoh");
+    convertHgrToPaToH(filename, filename + ".patoh");
+    ASSERT_THAT(readFile(filename + ".patoh"), Eq(readFile(filename + ".expected.patoh")));
+  }
+}
+
+TEST(AStreamingConverter, WritesTheSameMtxFileAsTheInMemoryConversion) {
+  for (const std::string filename : { "test_instances/mondriaan_example.hgr",
+                                      "test_instances/WeightedMtxExampleCorrect.hgr" }) {
+    const Hypergraph hypergraph = io::createHypergraphFromFile(filename, 2);
+    writeHypergraphInMatrixMarketFormat(hypergraph, filename + ".expected.mtx");
+    convertHgrToMtx(filename, filename + ".mtx");
+    ASSERT_THAT(readFile(filename + ".mtx"), Eq(readFile(filename + ".expected.mtx")));
+  }
+}
+
+TEST(AStreamingConverter, WritesTheSameEdgeListAsTheInMemoryConversion) {
+  const std::string filename("test_instances/mondriaan_example.hgr");
+  std::stringstream expected;
+  for (const Edge& edge : createEdgeVector(io::createHypergraphFromFile(filename, 2))) {
+    expected << edge.src << " " << edge.dest << "\n";
+  }
+  // spill to disk after every third entry
+  convertHgrToEdgeList(filename, filename + ".edgelist", 3);
+  ASSERT_THAT(readFile(filename + ".edgelist"), Eq(expected.str()));
+}
+
+TEST(AStreamingConverter, ConvertsMtxFilesToEquivalentHypergraphs) {
+  for (const std::string filename : { "test_instances/CoordinateGeneral.mtx",
+                                      "test_instances/CoordinateSymmetric.mtx",
+                                      "test_instances/EmptyRows.mtx",
+                                      "test_instances/WeightedMtxExample.mtx" }) {
+    mtxconversion::convertMtxToHgr(filename, filename + ".expected.hgr");
+    convertMtxToHgr(filename, filename + ".hgr", MatrixModel::row_net, 2);
+    const Hypergraph expected = io::createHypergraphFromFile(filename + ".expected.hgr", 2);
+    const Hypergraph actual = io::createHypergraphFromFile(filename + ".hgr", 2);
+    ASSERT_THAT(verifyEquivalenceWithoutPartitionInfo(expected, actual), Eq(true));
+  }
+}
+
+TEST(AStreamingConverter, ConvertsMtxFilesUsingTheColumnNetModel) {
+  const std::string filename("test_instances/EmptyRows.mtx");
+  convertMtxToHgr(filename, filename + ".column_net.hgr", MatrixModel::column_net, 2);
+  const Hypergraph hypergraph = io::createHypergraphFromFile(filename + ".column_net.hgr", 2);
+
+  ASSERT_THAT(hypergraph.initialNumNodes(), Eq(6));
+  ASSERT_THAT(hypergraph.initialNumEdges(), Eq(4));
+  ASSERT_THAT(hypergraph.initialNumPins(), Eq(8));
+  ASSERT_THAT(std::vector<HypernodeID>(hypergraph.pins(0).first, hypergraph.pins(0).second),
+              ContainerEq(std::vector<HypernodeID>({ 0, 5 })));
+}
+
+TEST(AStreamingConverterDeathTest, RejectsEntriesOutsideOfTheMatrix) {
+  const std::string filename("test_instances/ZeroBasedEntries.mtx");
+  std::ofstream out_stream(filename);
+  out_stream << "%%MatrixMarket matrix coordinate pattern general" << std::endl
+             << "2 3 2" << std::endl
+             << "1 1" << std::endl
+             << "0 2" << std::endl;
+  out_stream.close();
+
+  EXPECT_EXIT(convertMtxToHgr(filename, filename + ".hgr", MatrixModel::row_net, 2),
+              ::testing::ExitedWithCode(1), "Error: Entry 2 of MatrixMarket file is invalid");
+  std::remove(filename.c_str());
+}
+}  // namespace streaming
+}  // namespace kahypar